@@ -0,0 +1,376 @@
+# Python Script to Summarise Motor Performance Directly from FireSide Binary Logs
+
+#### Library Imports
+# Command Line Options
+from argparse import ArgumentParser
+
+# Calibration Files and Summary Output
+from json import dump, load
+
+# Memory Mapped Log Access and Record Header Parsing
+from mmap import mmap, ACCESS_READ
+from struct import unpack_from
+
+# Vectorised Sample Processing
+import numpy as np
+
+# Parallel Block Processing
+from concurrent.futures import ThreadPoolExecutor
+from os import cpu_count
+from os.path import getsize
+
+# Analysis Timing
+from time import perf_counter
+
+# Binary Log Format and Run Segment Discovery
+from ConvertLog import (
+  FindSegments, LOG_RECORD_MAGIC, LOG_RECORD_CONFIG, LOG_RECORD_FAST,
+  LOG_RECORD_SLOW, LOG_RECORD_EVENT, LOG_RECORD_GAP, LOG_RECORD_SEGMENT, LOG_RECORD_SYNC, LOG_FORMAT_VERSION,
+  MAX_PARALLEL_CHANNELS, ADC_CHANNEL_MAP, ADC_DMA_BLOCKLEN
+)
+
+
+#### Analysis Settings
+# Channel Calibration, Physical Value = Gain x Counts + Offset
+# Replace with Values from the Latest Bench Calibration
+# Inputs are ADC Pin Numbers, as in ADC_CHANNEL_MAP
+CALIBRATION = {
+  'thrust': {'input': 0, 'gain': 1.0, 'offset': 0.0, 'unit': 'N'},
+  'pressure': {'input': 1, 'gain': 1.0, 'offset': 0.0, 'unit': 'bar'}
+}
+
+# Burn Limits as a Fraction of Peak Thrust
+BURN_THRESHOLD = 0.05
+
+# Thrust Zero is the Mean of this Leading Window in Milliseconds
+TARE_WINDOW_MS = 50.0
+
+# Regular Blocks Processed per Worker Task
+CHUNK_BLOCKS = 256
+
+# Event Marker Code for Igniter Assertion, See Events.hpp
+EVENT_IGNITION = 2
+
+# Total Impulse Classes, Each Doubling from 2.5 N s for Class A
+MOTOR_CLASSES = 'ABCDEFGHIJKLMNO'
+
+
+#### Log Indexing
+# Walks Record Headers of a Log Segment without Reading Samples
+# Regular Blocks are Listed with Payload Offset and Scan Time Span
+# Events are Listed as (Code, Time, Cycles, Value)
+# Timebase Continuity Matches ConvertSegment in ConvertLog.py
+def IndexSegment(LogPath):
+  Index = {
+    'path': LogPath,
+    'channels': len(ADC_CHANNEL_MAP),
+    'map': list(ADC_CHANNEL_MAP),
+    'slowmap': [],
+    'bits': 12,
+    'blocklength': ADC_DMA_BLOCKLEN,
+    'offsets': [],
+    'slow': [],
+    'starts': [],
+    'ends': [],
+    'events': [],
+    'syncs': [],
+    'gaps': []
+  }
+
+  with open(LogPath, 'rb') as LogFile:
+    Map = mmap(LogFile.fileno(), 0, access=ACCESS_READ)
+
+  Size = len(Map)
+  Offset = 0
+  LastTime = -1
+
+  # Record Logs Open with a CONFIG Header, Headerless Logs Predate the Record
+  # Format and are Always 12-Bit, so their 1st Sample Never Matches the Magic
+  Legacy = Size >= 2 and (unpack_from('<H', Map, 0)[0] & 0XFF00) != LOG_RECORD_MAGIC
+
+  while Offset + 4 <= Size:
+    if Legacy:
+      Type, Length = LOG_RECORD_FAST, 2 * Index['blocklength'] + 4
+      Payload = Offset
+    else:
+      Type, Length = unpack_from('<HH', Map, Offset)
+      Payload = Offset + 4
+
+    # Stop at Truncated Record
+    if Payload + Length > Size:
+      break
+    Offset = Payload + Length
+
+    # Regular Block Layout and Channel Map, See LogConfigRecord
+    if Type == LOG_RECORD_CONFIG:
+      Config = unpack_from(f'<BBBBHHI{MAX_PARALLEL_CHANNELS}B{MAX_PARALLEL_CHANNELS}B', Map, Payload)
+      assert Config[0] == LOG_FORMAT_VERSION
+      Index['channels'] = Config[1]
+      Index['map'] = list(Config[7:7 + Config[1]])
+      Index['slowmap'] = list(Config[7 + MAX_PARALLEL_CHANNELS:][:Config[2]])
+      Index['blocklength'] = Config[4]
+
+      # High Resolution Logs Record their Sample Bits, Older Logs Hold 0
+      Index['bits'] = Config[3] or 12
+
+    # Slow Scan Blocks are Listed by Payload Offset and Length
+    elif Type == LOG_RECORD_SLOW:
+      Index['slow'].append((Payload, Length))
+
+    # Continue Timestamps from the Previous Segment
+    elif Type == LOG_RECORD_SEGMENT:
+      Previous = unpack_from('<I', Map, Payload + 4)[0]
+      if Previous:
+        LastTime = Previous
+
+    elif Type == LOG_RECORD_EVENT:
+      for Event in range(Payload, Payload + Length - 15, 16):
+        Code, _, Time, Cycles, Value = unpack_from('<HHIII', Map, Event)
+        Index['events'].append((Code, Time, Cycles, Value))
+
+    # Sync Pulse Edges Share the Microsecond Timebase of Sample Blocks
+    elif Type == LOG_RECORD_SYNC:
+      for Edge in range(Payload, Payload + Length - 7, 8):
+        Index['syncs'].append(unpack_from('<II', Map, Edge))
+
+    # Next Block Starts at Restart Time After a Fault
+    elif Type == LOG_RECORD_GAP:
+      Start, _, Resume, LostScans = unpack_from('<4I', Map, Payload)
+      Index['gaps'].append((Start, Resume, LostScans))
+      if LastTime != -1:
+        LastTime = Resume
+
+    elif Type == LOG_RECORD_FAST:
+      Time = unpack_from('<I', Map, Payload + 2 * Index['blocklength'])[0]
+
+      # First Block Only Seeds the Timebase
+      if LastTime != -1:
+        Index['offsets'].append(Payload)
+        Index['starts'].append(LastTime)
+        Index['ends'].append(Time)
+      LastTime = Time
+
+  Map.close()
+
+  Index['offsets'] = np.array(Index['offsets'], dtype=np.int64)
+  Index['starts'] = np.array(Index['starts'], dtype=np.float64)
+  Index['ends'] = np.array(Index['ends'], dtype=np.float64)
+
+  return Index
+
+
+#### Block Processing
+# Loads Scans of Regular Blocks as (Blocks, Scans, Channels) Counts
+def LoadBlocks(Samples, Index, Blocks):
+  Length = Index['blocklength']
+  Words = Index['offsets'][Blocks] // 2
+  Data = Samples[(Words[:, None] + np.arange(Length)).ravel()]
+  return Data.reshape(len(Words), Length // Index['channels'], Index['channels'])
+
+# Calibrates One Channel of Loaded Blocks
+def Calibrate(Data, Index, Channel, Tare = 0.0):
+  Position = Index['map'].index(Channel['input'])
+  return Data[:, :, Position] * Channel['gain'] + (Channel['offset'] - Tare)
+
+# Reduces a Range of Regular Blocks to Per Block Aggregates
+# Runs in Worker Threads, NumPy Releases the GIL for Array Work
+def AnalyseChunk(Samples, Index, Blocks, Thrust, Pressure, Tare):
+  Data = LoadBlocks(Samples, Index, Blocks)
+  Scans = Data.shape[1]
+
+  # Each Scan Stands for an Equal Share of its Block's Time Span
+  Period = (Index['ends'][Blocks] - Index['starts'][Blocks]) / Scans * 1e-6
+
+  Force = Calibrate(Data, Index, Thrust, Tare)
+  Chamber = Calibrate(Data, Index, Pressure)
+
+  return {
+    'thrustpeak': Force.max(axis=1),
+    'thrustarea': Force.sum(axis=1) * Period,
+    'pressurepeak': Chamber.max(axis=1),
+    'pressurearea': Chamber.sum(axis=1) * Period
+  }
+
+# Scan Times of One Regular Block in Microseconds
+def BlockTimes(Index, Block, Scans):
+  Start, End = Index['starts'][Block], Index['ends'][Block]
+  return Start + (End - Start) * np.arange(Scans) / Scans
+
+
+#### Run Analysis
+# Summarises Burn Performance for All Segments of a Run
+def AnalyseRun(Segments, Thrust, Pressure, Threshold, TareWindow, Threads):
+  Run = []
+
+  for LogPath in Segments:
+    Index = IndexSegment(LogPath)
+    for Channel in (Thrust, Pressure):
+      if Channel['input'] not in Index['map']:
+        raise ValueError('A' + str(Channel['input']) + ' is not a Regular Channel in ' + LogPath)
+
+    Samples = np.memmap(LogPath, dtype='<u2', mode='r', shape=(getsize(LogPath) // 2,))
+    Run.append((Index, Samples))
+
+  # Thrust Zero from Leading Window of 1st Segment
+  Index, Samples = Run[0]
+  if not len(Index['offsets']):
+    raise ValueError('No Regular Blocks Logged')
+
+  Tare = 0.0
+  if TareWindow > 0:
+    Window = Index['starts'] < Index['starts'][0] + TareWindow * 1000
+    Tare = float(Calibrate(
+      LoadBlocks(Samples, Index, np.flatnonzero(Window)), Index, Thrust
+    ).mean())
+
+  # Reduce Blocks of All Segments in Parallel
+  Tasks = []
+  with ThreadPoolExecutor(max_workers=Threads) as Pool:
+    for Segment, (Index, Samples) in enumerate(Run):
+      for First in range(0, len(Index['offsets']), CHUNK_BLOCKS):
+        Blocks = np.arange(First, min(First + CHUNK_BLOCKS, len(Index['offsets'])))
+        Tasks.append((Segment, Blocks, Pool.submit(
+          AnalyseChunk, Samples, Index, Blocks, Thrust, Pressure, Tare
+        )))
+
+    # Join Chunk Results in Log Order
+    Keys = [(Segment, Block) for Segment, Blocks, _ in Tasks for Block in Blocks]
+    Parts = [Task.result() for _, _, Task in Tasks]
+    Blocks = {Name: np.concatenate([Part[Name] for Part in Parts]) for Name in Parts[0]}
+
+  # Burn Spans Blocks from First to Last Crossing of the Thrust Threshold
+  Peak = int(np.argmax(Blocks['thrustpeak']))
+  Limit = Threshold * Blocks['thrustpeak'][Peak]
+  Above = np.flatnonzero(Blocks['thrustpeak'] >= Limit)
+  First, Last = int(Above[0]), int(Above[-1])
+
+  # Resolve Burn Limits and Peak to Single Scans within their Blocks
+  def Scan(Block):
+    Segment, Local = Keys[Block]
+    Index, Samples = Run[Segment]
+    Data = LoadBlocks(Samples, Index, np.array([Local]))
+    Times = BlockTimes(Index, Local, Data.shape[1])
+    Period = (Times[1] - Times[0]) * 1e-6 if len(Times) > 1 else 0.0
+    return (
+      Calibrate(Data, Index, Thrust, Tare)[0],
+      Calibrate(Data, Index, Pressure)[0],
+      Times, Period
+    )
+
+  Force, Chamber, Times, Period = Scan(First)
+  Start = int(np.flatnonzero(Force >= Limit)[0])
+  BurnStart = Times[Start]
+
+  # Area of Partial Boundary Blocks Inside the Burn
+  Impulse = Force[Start:].sum() * Period
+  PressureArea = Chamber[Start:].sum() * Period
+
+  Force, Chamber, Times, Period = Scan(Last)
+  End = int(np.flatnonzero(Force >= Limit)[-1])
+  BurnEnd = Times[End]
+
+  if First == Last:
+    Impulse = Force[Start:End + 1].sum() * Period
+    PressureArea = Chamber[Start:End + 1].sum() * Period
+  else:
+    Impulse += Force[:End + 1].sum() * Period
+    PressureArea += Chamber[:End + 1].sum() * Period
+
+    # Whole Blocks Inside the Burn
+    Impulse += Blocks['thrustarea'][First + 1:Last].sum()
+    PressureArea += Blocks['pressurearea'][First + 1:Last].sum()
+
+  Force, _, Times, _ = Scan(Peak)
+  PeakTime = Times[int(np.argmax(Force))]
+
+  BurnTime = (BurnEnd - BurnStart) * 1e-6
+
+  # Report Times Relative to Ignition, or to the 1st Scan
+  Events = [Event for Index, _ in Run for Event in Index['events']]
+  Ignitions = [Time for Code, Time, _, _ in Events if Code == EVENT_IGNITION]
+  Origin = Ignitions[0] if Ignitions else Run[0][0]['starts'][0]
+
+  # Gaps Overlapping the Burn Leave Impulse Understated
+  Gaps = [
+    Gap for Index, _ in Run for Gap in Index['gaps']
+    if Gap[1] >= BurnStart and Gap[0] <= BurnEnd
+  ]
+
+  # Motor Class from Total Impulse
+  Class = int(np.ceil(np.log2(max(Impulse, 1e-9) / 2.5)))
+  Class = MOTOR_CLASSES[Class] if 0 <= Class < len(MOTOR_CLASSES) else '-'
+
+  return {
+    'Burn Start (s)': (BurnStart - Origin) * 1e-6,
+    'Burn End (s)': (BurnEnd - Origin) * 1e-6,
+    'Burn Time (s)': BurnTime,
+    'Ignition Delay (s)': (BurnStart - Ignitions[0]) * 1e-6 if Ignitions else None,
+    'Peak Thrust (' + Thrust['unit'] + ')': float(Blocks['thrustpeak'][Peak]),
+    'Peak Thrust Time (s)': (PeakTime - Origin) * 1e-6,
+    'Average Thrust (' + Thrust['unit'] + ')': Impulse / BurnTime if BurnTime else 0.0,
+    'Total Impulse (' + Thrust['unit'] + ' s)': float(Impulse),
+    'Motor Class': Class,
+    'Peak Chamber Pressure (' + Pressure['unit'] + ')': float(Blocks['pressurepeak'][First:Last + 1].max()),
+    'Average Chamber Pressure (' + Pressure['unit'] + ')': PressureArea / BurnTime if BurnTime else 0.0,
+    'Thrust Tare (' + Thrust['unit'] + ')': Tare,
+    'Gaps During Burn': len(Gaps),
+    'Scans Lost During Burn': sum(Gap[2] for Gap in Gaps),
+    'Scans Analysed': int(sum(Index['offsets'].size * Index['blocklength'] // Index['channels'] for Index, _ in Run))
+  }
+
+
+#### Analyse Log
+if __name__ == '__main__':
+  Parser = ArgumentParser(description='FireSide Binary Log Burn Analysis')
+  Parser.add_argument('log', help='Binary Log File, Other Segments of the Run are Included')
+  Parser.add_argument('--calibration', help='JSON File Overriding Thrust and Pressure Calibration')
+  Parser.add_argument('--threshold', type=float, default=BURN_THRESHOLD, help='Burn Limits as Fraction of Peak Thrust')
+  Parser.add_argument('--tare', type=float, default=TARE_WINDOW_MS, help='Thrust Zero Window in ms, 0 Disables')
+  Parser.add_argument('--threads', type=int, default=cpu_count(), help='Worker Threads')
+  Parser.add_argument('--json', help='Write Summary to this JSON File')
+  Options = Parser.parse_args()
+
+  # Display Script Startup
+  print('#########')
+  print('FireSide Binary Log Burn Analysis')
+  print('#########')
+  print('')
+
+  # Merge Calibration Overrides
+  Calibration = {Name: dict(Channel) for Name, Channel in CALIBRATION.items()}
+  if Options.calibration:
+    with open(Options.calibration, 'r') as CalibrationFile:
+      for Name, Channel in load(CalibrationFile).items():
+        Calibration[Name].update(Channel)
+
+  print('>> Calibration')
+  for Name, Channel in Calibration.items():
+    print('{:<9} A{} x {} + {} {}'.format(
+      Name, Channel['input'], Channel['gain'], Channel['offset'], Channel['unit']
+    ))
+  print('')
+
+  Segments = FindSegments(Options.log)
+  LogBytes = sum(getsize(Path) for Path in Segments)
+  print('>> Analysing ' + str(len(Segments)) + ' Segment(s), {:.2f} MB'.format(LogBytes / 1e6))
+
+  Start = perf_counter()
+  Summary = AnalyseRun(
+    Segments, Calibration['thrust'], Calibration['pressure'],
+    Options.threshold, Options.tare, Options.threads
+  )
+  Elapsed = perf_counter() - Start
+  print('')
+
+  print('>> Burn Summary')
+  for Name, Value in Summary.items():
+    if isinstance(Value, float):
+      Value = '{:.6g}'.format(Value)
+    print('{:<32} {}'.format(Name, Value))
+  print('')
+
+  print('Analysed in {:.2f} s, {:.1f} MB/s'.format(Elapsed, LogBytes / 1e6 / Elapsed))
+
+  if Options.json:
+    with open(Options.json, 'w') as SummaryFile:
+      dump(Summary, SummaryFile, indent=2)
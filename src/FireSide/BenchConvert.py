@@ -0,0 +1,306 @@
+# Python Script to Benchmark Binary Log Decoding and CSV Conversion
+
+#### Library Imports
+# Command Line Options for Repeatable Runs
+from argparse import ArgumentParser
+
+# Synthetic Log Generation
+from array import array
+from random import Random
+from struct import pack, unpack_from
+
+# Stage Timing and Results Storage
+from time import perf_counter
+from datetime import datetime, timezone
+from json import dump, load
+from platform import platform, python_version
+from io import StringIO
+from csv import DictWriter
+
+# Temporary Benchmark Files
+from os.path import exists, getsize, join
+from tempfile import mkdtemp
+from shutil import rmtree
+
+# Converter Stages under Test
+from ConvertLog import (
+  ReadRecords, DecodeBlock, DeinterleaveBlock, InterpolateTimes, BuildRows,
+  ConvertRun, LOG_RECORD_CONFIG, LOG_RECORD_FAST,
+  LOG_RECORD_SLOW, LOG_RECORD_EVENT, LOG_RECORD_SEGMENT, LOG_RECORD_SYNC, LOG_FORMAT_VERSION,
+  MAX_PARALLEL_CHANNELS
+)
+
+
+#### Synthetic Log Definitions
+# Scans per Regular DMA Block, See ADC_DMA_BLOCKLEN in DMADAQ.cpp
+SCANS_PER_BLOCK = 512
+
+# Regular Scan Period per Channel in Microseconds
+# (92.5 + 12.5) Cycles x 8 Oversampling at 20 MHz ADC Clock
+CHANNEL_SCAN_US = 42
+
+# Slow Channel Scans per Block and Period, See Interfaces.hpp
+SLOW_BLOCK_SCANS = 64
+SLOW_PERIOD_US = 10000
+
+# First Regular Block Timestamp in Microseconds
+START_TIME_US = 1000000
+
+# Event Marker Codes, See Events.hpp
+EVENT_LOG_START = 1
+EVENT_IGNITION = 2
+EVENT_LOG_STOP = 3
+
+# Simulated Sync Pulse Period in Microseconds, See Sync.hpp
+SYNC_PERIOD_US = 100000
+
+
+# Writes One Record in LogBuffersinLoop Layout
+def WriteRecord(LogFile, Type, Payload):
+  LogFile.write(pack('<HH', Type, len(Payload)))
+  LogFile.write(Payload)
+
+# Writes Event Marker Record with Times in Microseconds
+# Cycle Counts Wrap at 32 Bits, as the DWT Counter does
+def WriteEvents(LogFile, Events):
+  WriteRecord(LogFile, LOG_RECORD_EVENT, b''.join(
+    pack('<HHIII', Code, 0, Time, (Time * 80) & 0XFFFFFFFF, 0) for Code, Time in Events
+  ))
+
+# Writes Slow Record of Count Scans Taken Every SLOW_PERIOD_US from Start
+def WriteSlowRecord(LogFile, Start, Count, Inputs):
+  WriteRecord(LogFile, LOG_RECORD_SLOW, b''.join(
+    pack(
+      f'<I{len(Inputs)}H',
+      Start + Scan * SLOW_PERIOD_US,
+      *[(Scan * 64 + Input) & 0X0FFF for Input in Inputs]
+    ) for Scan in range(Count)
+  ))
+
+# Generates a Synthetic Binary Log of About Size Bytes
+# Record Sequence Matches LogBuffersinLoop in DMADAQ.cpp
+# A Nonzero SyncPeriod Adds Sync Pulse Edges from a Simulated Source
+# Returns Number of Regular Blocks Written
+def WriteSyntheticLog(LogPath, Size, Channels, SlowChannels = 0, Seed = 0, SyncPeriod = 0):
+  assert 1 <= Channels and Channels + SlowChannels <= MAX_PARALLEL_CHANNELS
+  assert SlowChannels <= 4
+
+  BlockLength = Channels * SCANS_PER_BLOCK
+  BlockPeriod = SCANS_PER_BLOCK * Channels * CHANNEL_SCAN_US
+  Blocks = max(2, Size // (2 * BlockLength + 8))
+
+  # Noisy 12-Bit Base Block, Shifted for Each Block
+  Generator = Random(Seed)
+  Base = [Generator.randrange(4096) for _ in range(BlockLength)]
+
+  FastInputs = list(range(Channels))
+  SlowInputs = list(range(Channels, Channels + SlowChannels))
+
+  with open(LogPath, 'wb') as LogFile:
+    # Configuration and Segment Records Lead Each Log File
+    WriteRecord(LogFile, LOG_RECORD_CONFIG, pack(
+      f'<BBBBHHI{MAX_PARALLEL_CHANNELS}B{MAX_PARALLEL_CHANNELS}B',
+      LOG_FORMAT_VERSION, Channels, SlowChannels, 0, BlockLength,
+      SLOW_BLOCK_SCANS if SlowChannels else 0,
+      SLOW_PERIOD_US if SlowChannels else 0,
+      *(FastInputs + [0] * (MAX_PARALLEL_CHANNELS - Channels)),
+      *(SlowInputs + [0] * (MAX_PARALLEL_CHANNELS - SlowChannels))
+    ))
+    WriteRecord(LogFile, LOG_RECORD_SEGMENT, pack('<HHI', 0, 0, 0))
+
+    Time = START_TIME_US
+    WriteEvents(LogFile, [(EVENT_LOG_START, Time)])
+    Sequence = 0
+
+    # Slow Scans Run on their Own Timer from Logging Start
+    # Time of the 1st Scan in the Slow Block Being Filled
+    SlowTime = START_TIME_US
+
+    for Block in range(Blocks):
+      # Block Timestamp Latched at DMA Callback with Small Jitter
+      Time += BlockPeriod + Generator.randrange(-2, 3)
+      Samples = array('H', ((Value + Block) & 0X0FFF for Value in Base))
+      WriteRecord(LogFile, LOG_RECORD_FAST, Samples.tobytes() + pack('<I', Time))
+
+      if Block == 0:
+        WriteEvents(LogFile, [(EVENT_IGNITION, Time + 100)])
+
+      # Slow Blocks Completed Before the Current Block, Written After it
+      while SlowChannels and SlowTime + (SLOW_BLOCK_SCANS - 1) * SLOW_PERIOD_US <= Time:
+        WriteSlowRecord(LogFile, SlowTime, SLOW_BLOCK_SCANS, SlowInputs)
+        SlowTime += SLOW_BLOCK_SCANS * SLOW_PERIOD_US
+
+      # Sync Edges Captured Since the Previous Block
+      Edges = []
+      while SyncPeriod and START_TIME_US + (Sequence + 1) * SyncPeriod <= Time:
+        Edges.append(pack('<II', START_TIME_US + (Sequence + 1) * SyncPeriod, Sequence))
+        Sequence += 1
+      if Edges:
+        WriteRecord(LogFile, LOG_RECORD_SYNC, b''.join(Edges))
+
+    # Partial Slow Block Kept at Stop, as LogBuffersinLoop does
+    if SlowChannels and SlowTime <= Time:
+      WriteSlowRecord(LogFile, SlowTime, (Time - SlowTime) // SLOW_PERIOD_US + 1, SlowInputs)
+
+    WriteEvents(LogFile, [(EVENT_LOG_STOP, Time + 100)])
+
+  return Blocks
+
+
+#### Benchmark Stages
+# Each Stage Consumes the Output of the Previous Stage
+# Returns Stage Output and Number of Items Produced
+
+# Record Parsing and Regular Block Unpacking
+def StageDecode(LogPath):
+  Blocks = []
+  with open(LogPath, 'rb') as LogFile:
+    for Type, Payload in ReadRecords(LogFile):
+      if Type == LOG_RECORD_CONFIG:
+        # Regular Block Length, See LogConfigRecord in LogFormat.hpp
+        BlockLength = unpack_from('<H', Payload, 4)[0]
+      elif Type == LOG_RECORD_FAST:
+        Blocks.append(DecodeBlock(Payload, BlockLength))
+
+  return Blocks, len(Blocks)
+
+# Interleaved Samples to Per Scan Tuples
+def StageDeinterleave(Blocks, Channels):
+  Scans = [DeinterleaveBlock(Data, Channels) for Data, _ in Blocks]
+  return Scans, sum(len(Block) for Block in Scans)
+
+# Per Scan Timestamps from Block Timestamps
+# First Block Only Seeds the Timebase, as in ConvertSegment
+def StageInterpolate(Blocks, Channels):
+  Times = [
+    InterpolateTimes(Blocks[Index - 1][1], Blocks[Index][1], len(Blocks[Index][0]), Channels)
+    for Index in range(1, len(Blocks))
+  ]
+  return Times, sum(len(Block) for Block in Times)
+
+# Row Assembly and CSV Text Formatting in Memory
+def StageFormat(Times, Scans, Labels):
+  Output = StringIO()
+  TableWriter = DictWriter(
+    Output,
+    fieldnames=['Time (us)'] + Labels,
+    lineterminator='\r\n'
+  )
+  Rows = 0
+  for BlockTimes, BlockScans in zip(Times, Scans[1:]):
+    BlockRows = BuildRows(BlockTimes, BlockScans, Labels)
+    TableWriter.writerows(BlockRows)
+    Rows += len(BlockRows)
+
+  return Output, Rows
+
+# Complete Conversion to CSV File on Disk
+def StageConvert(LogPath, CSVPath, Stream = False):
+  ConvertRun([LogPath], CSVPath, Stream)
+  with open(CSVPath, 'rb') as CSVFile:
+    Rows = sum(1 for _ in CSVFile) - 1
+
+  return None, Rows
+
+
+# Times a Stage, Keeping the Fastest of Repeat Runs
+def TimeStage(Repeat, Stage, *Arguments):
+  Best = None
+  for _ in range(Repeat):
+    Start = perf_counter()
+    Output, Count = Stage(*Arguments)
+    Elapsed = perf_counter() - Start
+    Best = Elapsed if Best is None else min(Best, Elapsed)
+
+  return Output, Count, Best
+
+
+#### Run Benchmark
+if __name__ == '__main__':
+  Parser = ArgumentParser(description='FireSide Binary Log Conversion Benchmark')
+  Parser.add_argument('--size', type=float, default=8.0, help='Synthetic Log Size in MB')
+  Parser.add_argument('--channels', type=int, default=6, help='Regular ADC Channels')
+  Parser.add_argument('--slow', type=int, default=0, help='Slow ADC Channels')
+  Parser.add_argument('--repeat', type=int, default=3, help='Runs per Stage, Fastest is Kept')
+  Parser.add_argument('--seed', type=int, default=0, help='Synthetic Sample Seed')
+  Parser.add_argument('--sync', action='store_true', help='Add Simulated Sync Pulse Edges to the Synthetic Log')
+  Parser.add_argument('--label', default='', help='Free Text Stored with the Results')
+  Parser.add_argument('--results', default='BenchResults.json', help='JSON Results File')
+  Options = Parser.parse_args()
+
+  # Display Script Startup
+  print('#########')
+  print('FireSide Binary Log Conversion Benchmark')
+  print('#########')
+  print('')
+
+  Folder = mkdtemp(prefix='BenchConvert')
+  LogPath = join(Folder, '0.dat')
+  CSVPath = join(Folder, '0.csv')
+
+  try:
+    # Generate Synthetic Log
+    print('>> Generating Synthetic Log')
+    WriteSyntheticLog(
+      LogPath, int(Options.size * 1024 * 1024),
+      Options.channels, Options.slow, Options.seed,
+      SYNC_PERIOD_US if Options.sync else 0
+    )
+    LogBytes = getsize(LogPath)
+    print('Log Size: {:.2f} MB'.format(LogBytes / 1e6))
+    print('')
+
+    Labels = ['A' + str(Input) for Input in range(Options.channels)]
+    Stages = {}
+
+    # Time Each Stage
+    print('>> Timing Stages, Best of ' + str(Options.repeat))
+    Blocks, _, Stages['decode'] = TimeStage(Options.repeat, StageDecode, LogPath)
+    Scans, _, Stages['deinterleave'] = TimeStage(Options.repeat, StageDeinterleave, Blocks, Options.channels)
+    Times, Rows, Stages['interpolate'] = TimeStage(Options.repeat, StageInterpolate, Blocks, Options.channels)
+    _, _, Stages['format'] = TimeStage(Options.repeat, StageFormat, Times, Scans, Labels)
+    _, _, Stages['convert'] = TimeStage(Options.repeat, StageConvert, LogPath, CSVPath)
+    _, _, Stages['stream'] = TimeStage(Options.repeat, StageConvert, LogPath, CSVPath, True)
+
+    # Rates Relative to Binary Input Size and Converted Scan Rows
+    Results = {}
+    for Name, Seconds in Stages.items():
+      Results[Name] = {
+        'seconds': Seconds,
+        'MB/s': LogBytes / 1e6 / Seconds,
+        'rows/s': Rows / Seconds
+      }
+      print('{:<12} {:8.3f} s {:9.2f} MB/s {:12.0f} rows/s'.format(
+        Name, Seconds, Results[Name]['MB/s'], Results[Name]['rows/s']
+      ))
+
+  finally:
+    rmtree(Folder, ignore_errors=True)
+
+  # Append Run to Results File for Comparison Over Time
+  Runs = []
+  if exists(Options.results):
+    with open(Options.results, 'r') as ResultsFile:
+      Runs = load(ResultsFile)
+
+  Runs.append({
+    'time': datetime.now(timezone.utc).isoformat(),
+    'label': Options.label,
+    'python': python_version(),
+    'platform': platform(),
+    'config': {
+      'bytes': LogBytes,
+      'channels': Options.channels,
+      'slow': Options.slow,
+      'repeat': Options.repeat,
+      'seed': Options.seed,
+      'rows': Rows
+    },
+    'stages': Results
+  })
+
+  with open(Options.results, 'w') as ResultsFile:
+    dump(Runs, ResultsFile, indent=2)
+
+  print('')
+  print('Results File Location: ' + Options.results)
@@ -0,0 +1,222 @@
+#ifndef _CHANNELS_H_
+#define _CHANNELS_H_
+// #### Library Headers
+// Fixed Width Integer and Size Types
+#include <stdint.h>
+#include <stddef.h>
+
+// Index Sequences for Unrolled Channel Loops
+#include <utility>
+
+// STM32 L4 Board HAL Include
+#include <stm32l4xx_hal.h>
+
+
+// #### Compile Time ADC Channel Descriptions
+// Number of Analog Inputs Available for Logging
+// See CN4 on Page 29 of MB1180 Nucleo L412KB Board User Manual
+#define MAX_PARALLEL_CHANNELS 6
+
+// ADC Peripheral Bus Clock in MHz, Matches board_build.f_cpu
+#define ADC_BUS_CLOCK_MHZ 80UL
+
+// Regular Conversion Clock and Oversampling Description
+// Divider Scales the Bus Clock Down to the Synchronous ADC Clock
+// Ratio Conversions are Summed per Sample, then Shifted Right by Shift Bits
+// NOTE: Samples Hold 12 + log2(Ratio) - Shift Bits
+// See Page 440 in ST's RM0394 Manual For More Implementation Details
+template <uint8_t Divider, uint16_t Ratio, uint8_t Shift>
+struct ADCConversionTiming
+{
+  static_assert(
+    Divider == 1 || Divider == 2 || Divider == 4,
+    "Synchronous ADC Clock Divider must be 1, 2 or 4"
+  );
+  static_assert(
+    Ratio >= 2 && Ratio <= 256 && (Ratio & (Ratio - 1)) == 0,
+    "Oversampling Ratio must be a Power of 2 from 2 to 256"
+  );
+  static_assert(Shift <= 8, "Oversampling Right Shift must be 0 to 8 Bits");
+
+  // Base 2 Logarithm of Oversampling Ratio
+  static constexpr uint8_t Log2Ratio()
+  {
+    uint8_t log = 0;
+    while ((1U << log) < Ratio)
+    {
+      log++;
+    }
+
+    return log;
+  }
+
+  // Bits per Stored Sample After Summing and Shifting
+  static constexpr uint8_t bits = 12 + Log2Ratio() - Shift;
+  static_assert(bits >= 12, "Oversampling Shift Discards Converter Resolution");
+  static_assert(bits <= 16, "Oversampled Samples Exceed 16 Bits, Increase Shift");
+
+  // HAL Register Settings
+  static constexpr uint32_t prescaler =
+    (Divider == 1) ? ADC_CLOCK_SYNC_PCLK_DIV1 :
+    (Divider == 2) ? ADC_CLOCK_SYNC_PCLK_DIV2 : ADC_CLOCK_SYNC_PCLK_DIV4;
+
+  static constexpr uint32_t RatioCode()
+  {
+    // Indexed by log2(Ratio) - 1
+    constexpr uint32_t codes[8] = {
+      ADC_OVERSAMPLING_RATIO_2, ADC_OVERSAMPLING_RATIO_4,
+      ADC_OVERSAMPLING_RATIO_8, ADC_OVERSAMPLING_RATIO_16,
+      ADC_OVERSAMPLING_RATIO_32, ADC_OVERSAMPLING_RATIO_64,
+      ADC_OVERSAMPLING_RATIO_128, ADC_OVERSAMPLING_RATIO_256
+    };
+
+    return codes[Log2Ratio() - 1];
+  }
+
+  static constexpr uint32_t ShiftCode()
+  {
+    // Indexed by Shift
+    constexpr uint32_t codes[9] = {
+      ADC_RIGHTBITSHIFT_NONE, ADC_RIGHTBITSHIFT_1, ADC_RIGHTBITSHIFT_2,
+      ADC_RIGHTBITSHIFT_3, ADC_RIGHTBITSHIFT_4, ADC_RIGHTBITSHIFT_5,
+      ADC_RIGHTBITSHIFT_6, ADC_RIGHTBITSHIFT_7, ADC_RIGHTBITSHIFT_8
+    };
+
+    return codes[Shift];
+  }
+
+  // Regular Scan Period in Nanoseconds for a Channel Map
+  // Divider / Bus Clock x Ratio x Sum of (12.5 + Sampling Cycles) per Channel
+  template <typename Map>
+  static constexpr uint32_t ScanPeriodNS()
+  {
+    return (uint32_t)(
+      ((uint64_t)Map::ScanHalfCycles() * Ratio * Divider * 1000UL) / (2UL * ADC_BUS_CLOCK_MHZ)
+    );
+  }
+};
+
+// Logged ADC Channel Description
+// Input Indexes ADCHardwareSetup in Interfaces.hpp
+// NOTE: Cycles per Sample = 12.5 + Sampling Cycles
+template <uint8_t Input, uint32_t SampleTime = ADC_SAMPLETIME_92CYCLES_5>
+struct ADCChannel
+{
+  static_assert(Input < MAX_PARALLEL_CHANNELS, "ADC Input not Available on Pinout");
+
+  static constexpr uint8_t input = Input;
+  static constexpr uint32_t sampletime = SampleTime;
+};
+
+// Logged ADC Scan Sequence Description
+// Channels are Listed in ADC Rank and DMA Buffer Order
+template <typename... Channels>
+struct ADCChannelMap
+{
+  // Number of Channels in Each ADC Scan
+  static constexpr uint8_t count = sizeof...(Channels);
+
+  // Input and Sample Time of Each Channel in Scan Order
+  static constexpr uint8_t inputs[] = {Channels::input...};
+  static constexpr uint32_t sampletimes[] = {Channels::sampletime...};
+
+  // CSV Header Label Container
+  // 4 Characters per ", An" Label and 1 Terminator
+  struct LabelText
+  {
+    char text[4 * sizeof...(Channels) + 1];
+  };
+
+  // ADC Clock Half Cycles to Sample and Convert One Scan
+  // Conversion Takes 12.5 Cycles After Each Channel's Sample Time
+  // See Page 403 in ST's RM0394 Manual For More Implementation Details
+  static constexpr uint32_t ScanHalfCycles()
+  {
+    // Sample Time Half Cycles Indexed by ADC_SAMPLETIME Register Code
+    constexpr uint16_t sampling[8] = {5, 13, 25, 49, 95, 185, 495, 1281};
+    uint32_t total = 0;
+
+    for (uint8_t channel = 0; channel < count; channel++)
+    {
+      total += 25 + sampling[sampletimes[channel] & 0X07UL];
+    }
+
+    return total;
+  }
+
+  // Check Each Input is Logged Only Once
+  static constexpr bool Unique()
+  {
+    for (uint8_t first = 0; first < count; first++)
+    {
+      for (uint8_t second = first + 1; second < count; second++)
+      {
+        if (inputs[first] == inputs[second])
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  // Check No Input is Shared with Another Channel Map
+  template <typename Other>
+  static constexpr bool Disjoint()
+  {
+    for (uint8_t first = 0; first < count; first++)
+    {
+      for (uint8_t second = 0; second < Other::count; second++)
+      {
+        if (inputs[first] == Other::inputs[second])
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  // Assemble CSV Header Labels for Channels
+  // NOTE: Labels Follow the Pinout, Not the Scan Position
+  static constexpr LabelText BuildLabels()
+  {
+    LabelText labels = {};
+    uint16_t length = 0;
+
+    for (uint8_t channel = 0; channel < count; channel++)
+    {
+      labels.text[length++] = ',';
+      labels.text[length++] = ' ';
+      labels.text[length++] = 'A';
+      labels.text[length++] = '0' + inputs[channel];
+    }
+
+    labels.text[length] = '\0';
+    return labels;
+  }
+
+  // CSV Header Labels Generated at Compile Time
+  // Appended After the "Time (us)" Column
+  static constexpr LabelText labels = BuildLabels();
+
+  // Apply Function to Each Channel in Scan Order
+  // Function is Called as function(Position, Input) and Fully Unrolled
+  template <typename Function>
+  static inline void ForEach(Function &&function)
+  {
+    Unroll(function, std::make_index_sequence<sizeof...(Channels)>());
+  }
+
+private:
+  // Expand Function Calls over All Scan Positions
+  template <typename Function, size_t... Position>
+  static inline void Unroll(Function &function, std::index_sequence<Position...>)
+  {
+    (function(uint8_t(Position), uint8_t(inputs[Position])), ...);
+  }
+};
+
+#endif
@@ -0,0 +1,90 @@
+# Python Script to Check Streaming CSV Conversion Against Row Conversion
+# Synthetic Logs from BenchConvert.py are Converted Both Ways and Compared Byte for Byte
+
+#### Library Imports
+# Command Line Options for Repeatable Runs
+from argparse import ArgumentParser
+
+# Output Comparison
+from filecmp import cmp
+from os.path import exists, join
+
+# Temporary Check Files
+from tempfile import mkdtemp
+from shutil import rmtree
+
+# Synthetic Logs and Converter under Test
+from BenchConvert import WriteSyntheticLog, SYNC_PERIOD_US
+from ConvertLog import ConvertRun
+
+
+#### Check Definitions
+# (Regular, Slow) Channel Splits to Check
+# Covers No Slow Channels, Mostly Slow Channels and Single Regular Channel Layouts
+CHANNEL_SPLITS = [(6, 0), (4, 2), (1, 4), (3, 3)]
+
+
+# Converts Log with Both Converters and Compares CSV and Event Files
+# Returns List of Output Files that Differ
+def CheckLog(Folder, LogPath):
+  Outputs = []
+  for Stream in (False, True):
+    CSVPath = join(Folder, ('stream' if Stream else 'rows') + '.csv')
+    ConvertRun([LogPath], CSVPath, Stream)
+    Outputs.append(CSVPath)
+
+  Rows, Streamed = Outputs
+  Differ = []
+  for Suffix in ('.csv', '_EV.csv'):
+    RowsPath = Rows[:-4] + Suffix
+    StreamedPath = Streamed[:-4] + Suffix
+
+    # Event Files are Only Written for Logs with Markers
+    if exists(RowsPath) != exists(StreamedPath) or (
+      exists(RowsPath) and not cmp(RowsPath, StreamedPath, shallow=False)
+    ):
+      Differ.append(Suffix)
+
+  return Differ
+
+
+#### Run Checks
+if __name__ == '__main__':
+  Parser = ArgumentParser(description='FireSide Streaming Conversion Check')
+  Parser.add_argument('--size', type=float, default=2.0, help='Synthetic Log Size in MB')
+  Parser.add_argument('--seed', type=int, default=0, help='Synthetic Sample Seed')
+  Options = Parser.parse_args()
+
+  # Display Script Startup
+  print('#########')
+  print('FireSide Streaming Conversion Check')
+  print('#########')
+  print('')
+
+  Folder = mkdtemp(prefix='CheckConvert')
+  Failed = 0
+
+  try:
+    # Each Split is Checked with and without Sync Pulse Edges
+    for Channels, SlowChannels in CHANNEL_SPLITS:
+      for Sync in (False, True):
+        LogPath = join(Folder, '0.dat')
+        WriteSyntheticLog(
+          LogPath, int(Options.size * 1024 * 1024),
+          Channels, SlowChannels, Options.seed,
+          SYNC_PERIOD_US if Sync else 0
+        )
+
+        Differ = CheckLog(Folder, LogPath)
+        Failed += bool(Differ)
+        print('{} Regular, {} Slow, {:<8} {}'.format(
+          Channels, SlowChannels, 'Sync' if Sync else 'No Sync',
+          'Differ: ' + ', '.join(Differ) if Differ else 'Match'
+        ))
+
+  finally:
+    rmtree(Folder, ignore_errors=True)
+
+  print('')
+  print('{} of {} Checks Failed'.format(Failed, 2 * len(CHANNEL_SPLITS)))
+  exit(1 if Failed else 0)
@@ -4,158 +4,836 @@
 # Graceful Script Exit
 from sys import exit
 
+# Headless Batch Mode Options
+from argparse import ArgumentParser
+
 # CSV Writer Module using Dictionary Container
 from csv import DictWriter
 
-# User Interaction for File Location and Status Updates
-from tkinter import filedialog, messagebox, Tk
-
 # C/C++ Structure Unpacking Utility
-from struct import unpack
+from struct import unpack, unpack_from, iter_unpack
 
+# Vectorised Block Decoding in Streaming Mode
+import numpy as np
 
-# The C/C++ Data Storage Sequence
-# uint16_t Buffer[ADC_DMA_BLOCKLEN]
-# uint32_t Timestamp
+# Output File Name Handling
+from os import remove, cpu_count
+from os.path import basename, dirname, join, splitext, exists, getmtime, getsize
 
+# Segment File Name Matching
+from glob import glob
+from re import fullmatch, IGNORECASE
 
-# Display Script Startup
-print('#########')
-print('FireSide Binary Data File Convertor')
-print('#########')
-print('')
+# Parallel Conversion of Log Segments
+from concurrent.futures import ProcessPoolExecutor, as_completed
+from shutil import copyfileobj
 
+# Time Order Merge of Slow Scans and Segments
+from heapq import merge
+from time import perf_counter
 
-# Create Background Window Context for TKinter
-context = Tk()
-context.withdraw()
 
+# The C/C++ Data Storage Sequence
+# See LogFormat.hpp
+# Sequence of Records, Each Starting with
+#   uint16_t Type
+#   uint16_t Length
+# Followed by Length Bytes of Payload
+#
+# LOG_RECORD_FAST Payload, 12 to 16-Bit Samples per LogConfigRecord
+#   uint16_t Buffer[ADC_DMA_BLOCKLEN]
+#   uint32_t Timestamp
+#
+# LOG_RECORD_SLOW Payload, Repeated for Each Scan
+#   uint32_t Timestamp
+#   uint16_t Samples[ADC_SLOW_CHANNELS]
+#
+# LOG_RECORD_EVENT Payload, Repeated for Each Event
+#   uint16_t Code
+#   uint16_t Reserved
+#   uint32_t Timestamp
+#   uint32_t Cycles
+#   uint32_t Value
+#
+# LOG_RECORD_GAP Payload
+#   uint32_t Start
+#   uint32_t Fault
+#   uint32_t Resume
+#   uint32_t LostScans
+#   uint32_t Error
+#   uint32_t Faults
+#
+# LOG_RECORD_SEGMENT Payload
+#   uint16_t Index
+#   uint16_t Reserved
+#   uint32_t PreviousBlockTime
+#
+# LOG_RECORD_SYNC Payload, Repeated for Each Sync Pulse Edge
+#   uint32_t Timestamp
+#   uint32_t Sequence
+#
+# Logs Written Before Records were Introduced Hold Only
+# Back to Back LOG_RECORD_FAST Payloads Without Headers
+#
+# Long Runs may be Split into Segments N.dat, N_1.dat, N_2.dat, ...
+# Each Segment Starts with its Own Configuration and Segment Records
+
+
+# Binary Logfile Record Types
+# See LogFormat.hpp
+LOG_RECORD_MAGIC = 0xF500
+LOG_RECORD_CONFIG = LOG_RECORD_MAGIC | 0x01
+LOG_RECORD_FAST = LOG_RECORD_MAGIC | 0x02
+LOG_RECORD_SLOW = LOG_RECORD_MAGIC | 0x03
+LOG_RECORD_EVENT = LOG_RECORD_MAGIC | 0x04
+LOG_RECORD_GAP = LOG_RECORD_MAGIC | 0x05
+LOG_RECORD_SEGMENT = LOG_RECORD_MAGIC | 0x06
+LOG_RECORD_TRACE = LOG_RECORD_MAGIC | 0x07
+LOG_RECORD_SYNC = LOG_RECORD_MAGIC | 0x08
+LOG_FORMAT_VERSION = 1
+
+# Event Marker Names
+# See Events.hpp
+EVENT_NAMES = {
+  1: 'LOG START',
+  2: 'IGNITION',
+  3: 'LOG STOP',
+  4: 'ADC ERROR',
+  5: 'SD HIGHWATER',
+  6: 'QUEUE OVERFLOW',
+  7: 'FIRST BLOCK'
+}
+
+# Event CSV Columns
+EVENT_FIELDS = ['Time (us)', 'Cycles', 'Event', 'Value']
+
+# Regular Blocks Decoded and Written Together in Streaming Mode
+STREAM_CHUNK_BLOCKS = 64
+
+
+# Set Logged ADC Inputs in Scan Order for Headerless Logs
+# Record Based Logs Describe their Own Channel Maps
+# Must Match ADCLoggedChannels in Interfaces.hpp
+ADC_CHANNEL_MAP = [0, 1, 2, 3, 4, 5]
 
 # Set Number of ADC Channels
-ADC_PARALLEL_CHANNELS = 6
+ADC_PARALLEL_CHANNELS = len(ADC_CHANNEL_MAP)
 
 # Define Maximum Number of ADC Channels
-# See Interfaces.hpp
+# See Channels.hpp
 MAX_PARALLEL_CHANNELS = 6
-assert ADC_PARALLEL_CHANNELS <= MAX_PARALLEL_CHANNELS
+assert 1 <= ADC_PARALLEL_CHANNELS <= MAX_PARALLEL_CHANNELS
+assert len(set(ADC_CHANNEL_MAP)) == ADC_PARALLEL_CHANNELS
+assert all(0 <= input < MAX_PARALLEL_CHANNELS for input in ADC_CHANNEL_MAP)
+
+# Build Channel Labels in Scan Order
+# Labels Follow the Pinout, Not the Scan Position
+ADC_CHANNEL_LABELS = ['A' + str(input) for input in ADC_CHANNEL_MAP]
 
 # Calculate Buffer Length
 # See ConvertLog Function in DMADAQ.cpp
 ADC_DMA_BLOCKLEN = (ADC_PARALLEL_CHANNELS * 512)
 
-# Print Configuration and Notify User
-print('>> Converter Settings')
-print('ADC Parallel Channels: ' + str(ADC_PARALLEL_CHANNELS))
-print('ADC DMA Block Size: ' + str(ADC_DMA_BLOCKLEN))
-print('')
-
-
-# Ask User for Path to Input Binary File
-print('>> Input File Path [Select in Popup]')
-LogPath = filedialog.askopenfilename(
-  title='Select Binary Log File',
-  filetypes=[('FireSide Binary Log Files', '*.DAT')]
-)
-print('File Location: ' + str(LogPath))
-
-if not LogPath:
-  print('No File Found at Specified Path')
-  messagebox.showerror(
-    title='Binary Input File Not Found',
-    message=str(LogPath) + ' is Not Valid'
-  )
-  exit()
 
+# Iterates Over (Type, Payload) Records in a Binary Log File
+# Headerless Logs are Presented as LOG_RECORD_FAST Records
+def ReadRecords(LogFile):
+  # Check Upper Byte of First Record Type
+  # Record Logs Open with a CONFIG Header, Headerless Logs Predate the Record
+  # Format and are Always 12-Bit, so their 1st Sample Never Matches the Magic
+  head = LogFile.read(2)
+  LogFile.seek(0)
+  legacy = len(head) == 2 and \
+    (unpack('<H', head)[0] & 0xFF00) != LOG_RECORD_MAGIC
 
-# Allocate the CSV Data Containers
-CurrentRow = {}
-CSVDataTable = []
+  while True:
+    if legacy:
+      # Read Block from Log File
+      # Remove Offset and Calculate Size of Block in Bytes
+      payload = LogFile.read(2 * ADC_DMA_BLOCKLEN + 4)
+      Type = LOG_RECORD_FAST
+    else:
+      # Read Record Header then Payload
+      header = LogFile.read(4)
+      if len(header) < 4:
+        return
+      Type, Length = unpack('<HH', header)
+      payload = LogFile.read(Length)
+
+    # Check for End of File or Truncated Record
+    if not payload:
+      return
+
+    yield Type, payload
+
+
+#### Regular Block Conversion Stages
+# Kept Separate so BenchConvert.py can Time Each Stage
+
+# Unpacks a LOG_RECORD_FAST Payload into Samples and Timestamp
+# See C/C++ Structure at Start of Script
+def DecodeBlock(buffer, BlockLength):
+  values = unpack(f'<{BlockLength}HI', buffer)
+  return values[0:-1], values[-1]
+
+# Splits Interleaved Samples into One Tuple per Scan
+# NOTE : Samples are in Scan Order of Channel Map, See Interfaces.hpp
+def DeinterleaveBlock(data, Channels):
+  return [data[index:index + Channels] for index in range(0, len(data), Channels)]
+
+# Interpolates the Timestamp of Each Scan Between Block Timestamps
+def InterpolateTimes(LastTime, TimeStamp, Samples, Channels):
+  return [
+    int((((TimeStamp - LastTime) * index) / Samples) + LastTime)
+    for index in range(0, Samples, Channels)
+  ]
+
+# Pairs Scan Timestamps and Samples into CSV Row Dictionaries
+def BuildRows(Times, Scans, ChannelLabels):
+  Fields = ['Time (us)'] + ChannelLabels
+  return [dict(zip(Fields, (Time,) + Scan)) for Time, Scan in zip(Times, Scans)]
+
+
+# Finds All Segments of the Run a Log File Belongs to
+# Returns Paths in Segment Order, Starting with N.dat
+def FindSegments(LogPath):
+  # Extract Run ID from N.dat or N_K.dat
+  match = fullmatch(r'(\d+)(?:_\d+)?\.dat', basename(LogPath), IGNORECASE)
+  if not match:
+    return [LogPath]
+
+  # Collect Segments Belonging to the Same Run ID
+  segments = {}
+  for path in glob(join(dirname(LogPath), match.group(1) + '*')):
+    found = fullmatch(
+      match.group(1) + r'(?:_(\d+))?\.dat', basename(path), IGNORECASE
+    )
+    if found:
+      segments[int(found.group(1) or 0)] = path
+
+  return [segments[index] for index in sorted(segments)]
+
+
+# Converts One Binary Log File or Segment
+# Writes Sample Rows without Header to PartPath
+# Returns CSV Field Names and Event Marker Rows
+def ConvertSegment(LogPath, PartPath):
+  # Start from Headerless Log Defaults
+  ChannelLabels = ADC_CHANNEL_LABELS
+  SlowLabels = []
+  Channels = ADC_PARALLEL_CHANNELS
+  SlowChannels = 0
+  BlockLength = ADC_DMA_BLOCKLEN
+
+  # Allocate the CSV Data Containers
+  # Slow Records are Written After their Whole Block of Scans Completes,
+  # so Slow Rows are Kept Apart and Merged into Fast Rows by Time
+  CurrentRow = {}
+  CSVDataTable = []
+  SlowTable = []
+  EventTable = []
+
+  # Begin Conversion Procedure
+  # Iterate Through All Logged Records
+  with open(LogPath, 'rb') as LogFile:
+    # Initialise Time Stamp Container
+    LastTime = -1
+
+    for Type, buffer in ReadRecords(LogFile):
+      # Load Channel Maps from Configuration Record
+      # See LogConfigRecord in LogFormat.hpp
+      if Type == LOG_RECORD_CONFIG:
+        config = unpack(
+          f'<BBBBHHI{MAX_PARALLEL_CHANNELS}B{MAX_PARALLEL_CHANNELS}B', buffer
+        )
+        assert config[0] == LOG_FORMAT_VERSION
+
+        # Rebuild Fast and Slow Channel Maps in Scan Order
+        ChannelMap = config[7:7 + config[1]]
+        SlowMap = config[7 + MAX_PARALLEL_CHANNELS:][:config[2]]
+        Channels = len(ChannelMap)
+        SlowChannels = len(SlowMap)
+        BlockLength = config[4]
+
+        ChannelLabels = ['A' + str(input) for input in ChannelMap]
+        SlowLabels = ['A' + str(input) for input in SlowMap]
+        continue
+
+      # Continue Timestamps from the Previous Segment
+      # See LogSegmentRecord in LogFormat.hpp
+      if Type == LOG_RECORD_SEGMENT:
+        Index, _, Previous = unpack('<HHI', buffer)
+        if Previous:
+          LastTime = Previous
+        continue
+
+      # Decode Each Timestamped Scan of Slow Channels
+      # Slow Scans Share the Microsecond Timebase of Fast Blocks
+      if Type == LOG_RECORD_SLOW:
+        ScanLength = 4 + 2 * SlowChannels
+        for offset in range(0, len(buffer) - ScanLength + 1, ScanLength):
+          scan = unpack(
+            f'<I{SlowChannels}H', buffer[offset:offset + ScanLength]
+          )
+
+          # Fast Channel Columns are Left Blank
+          CurrentRow = {'Time (us)': scan[0]}
+          for channel in range(SlowChannels):
+            CurrentRow.update(
+              {SlowLabels[channel] : scan[1 + channel]}
+            )
+
+          SlowTable.append(CurrentRow)
+        continue
+
+      # Decode Each Event Marker
+      # Event Times Share the Microsecond Timebase of Sample Rows
+      if Type == LOG_RECORD_EVENT:
+        for Code, _, Time, Cycles, Value in iter_unpack('<HHIII', buffer):
+          EventTable.append({
+            'Time (us)': Time,
+            'Cycles': Cycles,
+            'Event': EVENT_NAMES.get(Code, 'UNKNOWN'),
+            'Value': Value
+          })
+        continue
+
+      # Export Sync Pulse Edges as Alignment Points for Other DAQs
+      # Value is the Edge Sequence Number, Gaps Mark Lost Edges
+      if Type == LOG_RECORD_SYNC:
+        for Time, Sequence in iter_unpack('<II', buffer):
+          EventTable.append({
+            'Time (us)': Time,
+            'Cycles': 0,
+            'Event': 'SYNC',
+            'Value': Sequence
+          })
+        continue
+
+      # Mark Missing Data After an ADC or DMA Fault
+      # See LogGapRecord in LogFormat.hpp
+      if Type == LOG_RECORD_GAP:
+        Start, Fault, Resume, LostScans, Error, Faults = unpack('<6I', buffer)
+
+        # Blank Row at Start of Gap
+        CSVDataTable.append({'Time (us)': Start})
+        EventTable.append({
+          'Time (us)': Start,
+          'Cycles': 0,
+          'Event': 'GAP',
+          'Value': LostScans
+        })
+
+        # Next Block Starts at Restart Time, Not at End of Previous Block
+        if LastTime != -1:
+          LastTime = Resume
+        continue
+
+      # Skip Unknown Records
+      if Type != LOG_RECORD_FAST:
+        continue
+
+      # Decode the DMA Buffer
+      data, TimeStamp = DecodeBlock(buffer, BlockLength)
+
+      # Load First Time Stamp
+      if LastTime == -1:
+        LastTime = TimeStamp
+        # Discard First Buffer
+        continue
 
+      # Append Converted ADC Sample Data to Table
+      CSVDataTable.extend(BuildRows(
+        InterpolateTimes(LastTime, TimeStamp, len(data), Channels),
+        DeinterleaveBlock(data, Channels),
+        ChannelLabels
+      ))
 
-# Begin Conversion Procedure
-# Iterate Through All Logged DMA Buffers
-print('>> Reading and Converting Binary File')
-with open(LogPath, 'rb') as LogFile:
-  # Initialise Time Stamp Container
-  LastTime = -1
+      # Update the TimeStamp for the Next Block
+      LastTime = TimeStamp
 
-  while True:
-    # Read Block from Log File
-    # Remove Offset and Calculate Size of Block in Bytes
-    buffer = LogFile.read(2 * ADC_DMA_BLOCKLEN + 4)
-
-    # Check for End of File
-    if not buffer:
-      break
-
-    # Decode the DMA Buffer and Unpack the Tuple
-    # See C/C++ Structure at Start of Script
-    buffer = unpack(
-      f'<{ADC_DMA_BLOCKLEN}HI', buffer
+  # Write Converted Data without Header
+  # Fast Rows Go Before Slow Rows with the Same Time
+  FieldNames = ['Time (us)'] + ChannelLabels + SlowLabels
+  with open(PartPath, 'w', newline='') as PartFile:
+    TableWriter = DictWriter(
+      PartFile,
+      fieldnames=FieldNames,
+      lineterminator='\r\n'
     )
-    data = buffer[0:-1]
-    TimeStamp = buffer[-1]
+    TableWriter.writerows(merge(CSVDataTable, SlowTable, key=lambda Row: Row['Time (us)']))
+
+  return FieldNames, EventTable
+
+
+#### Streaming Conversion
+# Formats Consecutive Regular Blocks as CSV Rows in One Pass
+# Starts Hold the Previous Timestamp of Each Block, Ends its Own
+# Returns Scan Times and Row Text
+def FormatBlocks(Payloads, Starts, Ends, Channels, BlockLength, Row):
+  Data = np.frombuffer(b''.join(Payloads), dtype=np.dtype(
+    [('samples', '<u2', (BlockLength,)), ('time', '<u4')]
+  ))['samples']
+
+  # Same Operation Order as InterpolateTimes, so Rounding Matches
+  Last = np.array(Starts, dtype=np.float64)[:, None]
+  TimeStamp = np.array(Ends, dtype=np.float64)[:, None]
+  Times = (
+    ((TimeStamp - Last) * np.arange(0, BlockLength, Channels)) / BlockLength + Last
+  ).astype(np.int64)
+
+  # Deinterleave Once, Each Scan Becomes One Row
+  Rows = np.column_stack((Times.ravel(), Data.reshape(-1, Channels)))
+  return Times.ravel(), list(map(Row.__mod__, map(tuple, Rows.tolist())))
+
+# Writes Held Fast and Slow Rows in Time Order, as merge in ConvertSegment
+# Fast Rows Up to FastLimit and Slow Rows Before SlowLimit are Written
+# Held Rows are (Times, Lines) Pairs, Returns the Rows Still Held
+def WriteMerged(PartFile, Fast, Slow, FastLimit, SlowLimit):
+  FastTimes, FastLines = Fast
+  SlowTimes, SlowLines = Slow
+  Fasts = int(np.searchsorted(FastTimes, FastLimit, side='right'))
+  Slows = int(np.searchsorted(SlowTimes, SlowLimit, side='left'))
+
+  # Each Slow Row Follows Every Fast Row Up to its Time
+  Before = np.searchsorted(FastTimes[:Fasts], SlowTimes[:Slows], side='right')
+  Lines = []
+  Written = 0
+  for Index, Line in zip(Before.tolist(), SlowLines[:Slows]):
+    Lines.extend(FastLines[Written:Index])
+    Lines.append(Line)
+    Written = Index
+  Lines.extend(FastLines[Written:Fasts])
+  PartFile.write(''.join(Lines))
+
+  return (FastTimes[Fasts:], FastLines[Fasts:]), (SlowTimes[Slows:], SlowLines[Slows:])
+
+# Appends Rows to Held (Times, Lines) Rows
+def HoldRows(Held, Times, Lines):
+  return np.concatenate((Held[0], np.asarray(Times, dtype=np.int64))), Held[1] + Lines
+
+# Converts One Binary Log File or Segment with Vectorised Block Decoding
+# Rows are Written in Chunks as the Log is Read, so Memory Use Stays Flat
+# Writes and Returns the Same as ConvertSegment
+def StreamSegment(LogPath, PartPath):
+  # Start from Headerless Log Defaults
+  ChannelLabels = ADC_CHANNEL_LABELS
+  SlowLabels = []
+  Channels = ADC_PARALLEL_CHANNELS
+  SlowChannels = 0
+  BlockLength = ADC_DMA_BLOCKLEN
+
+  # Regular Blocks Waiting to be Formatted
+  Payloads, Starts, Ends = [], [], []
+  EventTable = []
+
+  # Formatted Rows Held for the Time Order Merge
+  # Fast Rows Wait for Slow Scans Logged After Them, Slow Scans for Later Fast Rows
+  Empty = (np.zeros(0, dtype=np.int64), [])
+  Fast, Slow = Empty, Empty
+  LastSlow = -1
+
+  with open(LogPath, 'rb') as LogFile, open(PartPath, 'w', newline='') as PartFile:
+    LastTime = -1
+
+    for Type, buffer in ReadRecords(LogFile):
+      # Format Waiting Blocks Before Rows of Any Other Record
+      if Payloads and (Type != LOG_RECORD_FAST or len(Payloads) == STREAM_CHUNK_BLOCKS):
+        Fast = HoldRows(Fast, *FormatBlocks(
+          Payloads, Starts, Ends, Channels, BlockLength,
+          ','.join(['%d'] * (1 + Channels)) + ',' * SlowChannels + '\r\n'
+        ))
+        Payloads, Starts, Ends = [], [], []
+
+        # Later Slow Scans Follow Fast Rows Up to the Last Slow Scan
+        # Without Slow Channels Nothing Needs Holding
+        Fast, Slow = WriteMerged(
+          PartFile, Fast, Slow, LastSlow if SlowChannels else np.inf, LastTime
+        )
 
-    # Load First Time Stamp
-    if LastTime == -1:
+      # Load Channel Maps from Configuration Record
+      if Type == LOG_RECORD_CONFIG:
+        config = unpack(
+          f'<BBBBHHI{MAX_PARALLEL_CHANNELS}B{MAX_PARALLEL_CHANNELS}B', buffer
+        )
+        assert config[0] == LOG_FORMAT_VERSION
+
+        ChannelMap = config[7:7 + config[1]]
+        SlowMap = config[7 + MAX_PARALLEL_CHANNELS:][:config[2]]
+        Channels = len(ChannelMap)
+        SlowChannels = len(SlowMap)
+        BlockLength = config[4]
+
+        ChannelLabels = ['A' + str(input) for input in ChannelMap]
+        SlowLabels = ['A' + str(input) for input in SlowMap]
+        continue
+
+      # Continue Timestamps from the Previous Segment
+      if Type == LOG_RECORD_SEGMENT:
+        Index, _, Previous = unpack('<HHI', buffer)
+        if Previous:
+          LastTime = Previous
+        continue
+
+      # Slow Scans with Fast Channel Columns Left Blank
+      if Type == LOG_RECORD_SLOW:
+        ScanLength = 4 + 2 * SlowChannels
+        Scans = np.frombuffer(
+          buffer, dtype=np.dtype([('time', '<u4'), ('samples', '<u2', (SlowChannels,))]),
+          count=len(buffer) // ScanLength
+        )
+        if not len(Scans):
+          continue
+
+        Rows = np.column_stack((Scans['time'], Scans['samples'])).tolist()
+        Row = '%d' + ',' * Channels + ',%d' * SlowChannels + '\r\n'
+        Slow = HoldRows(Slow, Scans['time'], list(map(Row.__mod__, map(tuple, Rows))))
+        LastSlow = int(Scans['time'][-1])
+
+        # Later Fast Rows Start at the Last Block Timestamp
+        Fast, Slow = WriteMerged(PartFile, Fast, Slow, LastSlow, LastTime)
+        continue
+
+      if Type == LOG_RECORD_EVENT:
+        for Code, _, Time, Cycles, Value in iter_unpack('<HHIII', buffer):
+          EventTable.append({
+            'Time (us)': Time,
+            'Cycles': Cycles,
+            'Event': EVENT_NAMES.get(Code, 'UNKNOWN'),
+            'Value': Value
+          })
+        continue
+
+      # Export Sync Pulse Edges as Alignment Points for Other DAQs
+      # Value is the Edge Sequence Number, Gaps Mark Lost Edges
+      if Type == LOG_RECORD_SYNC:
+        for Time, Sequence in iter_unpack('<II', buffer):
+          EventTable.append({
+            'Time (us)': Time,
+            'Cycles': 0,
+            'Event': 'SYNC',
+            'Value': Sequence
+          })
+        continue
+
+      # Blank Row at Start of Gap
+      if Type == LOG_RECORD_GAP:
+        Start, Fault, Resume, LostScans, Error, Faults = unpack('<6I', buffer)
+        Fast = HoldRows(Fast, [Start], ['%d' % Start + ',' * (Channels + SlowChannels) + '\r\n'])
+        EventTable.append({
+          'Time (us)': Start,
+          'Cycles': 0,
+          'Event': 'GAP',
+          'Value': LostScans
+        })
+
+        if LastTime != -1:
+          LastTime = Resume
+        continue
+
+      # Skip Unknown Records and Truncated Blocks
+      if Type != LOG_RECORD_FAST or len(buffer) != 2 * BlockLength + 4:
+        continue
+
+      TimeStamp = unpack_from('<I', buffer, 2 * BlockLength)[0]
+
+      # First Block Only Seeds the Timebase
+      if LastTime != -1:
+        Payloads.append(buffer)
+        Starts.append(LastTime)
+        Ends.append(TimeStamp)
       LastTime = TimeStamp
-      # Discard First Buffer
+
+    # Write Remaining Blocks and Held Rows
+    if Payloads:
+      Fast = HoldRows(Fast, *FormatBlocks(
+        Payloads, Starts, Ends, Channels, BlockLength,
+        ','.join(['%d'] * (1 + Channels)) + ',' * SlowChannels + '\r\n'
+      ))
+    WriteMerged(PartFile, Fast, Slow, np.inf, np.inf)
+
+  return ['Time (us)'] + ChannelLabels + SlowLabels, EventTable
+
+
+# Converts One Segment and Measures Conversion Time
+# Returns CSV Field Names, Event Marker Rows and Seconds Taken
+def TimeSegment(LogPath, PartPath, Stream = False):
+  Start = perf_counter()
+  FieldNames, EventTable = (StreamSegment if Stream else ConvertSegment)(LogPath, PartPath)
+  return FieldNames, EventTable, perf_counter() - Start
+
+
+# Converts All Segments of a Run into One CSV File
+# Segments are Converted Concurrently then Joined in Order
+# Stream Selects Vectorised Conversion with Identical Output
+def ConvertRun(Segments, CSVPath, Stream = False):
+  PartPaths = [CSVPath + '.part' + str(index) for index in range(len(Segments))]
+  Convert = StreamSegment if Stream else ConvertSegment
+
+  # Convert Single Segment Runs In Process
+  if len(Segments) == 1:
+    Results = [Convert(Segments[0], PartPaths[0])]
+  else:
+    with ProcessPoolExecutor() as Pool:
+      Results = list(Pool.map(Convert, Segments, PartPaths))
+
+  JoinRun(Results, PartPaths, CSVPath)
+
+
+# Time of a CSV Row Line
+def RowTime(Line):
+  return int(Line[:Line.index(',')])
+
+# Times of the First and Last Row of a Converted Part File
+# Returns None for Parts without Rows
+def PartSpan(PartPath):
+  with open(PartPath, 'rb') as PartFile:
+    First = PartFile.readline()
+    if not First:
+      return None
+
+    # Rows are Far Shorter than the Tail Read
+    PartFile.seek(max(0, getsize(PartPath) - 4096))
+    Last = PartFile.read().splitlines()[-1]
+
+  return RowTime(First.decode()), RowTime(Last.decode())
+
+# Joins Converted Segments of a Run into One CSV File
+# Results Hold (Field Names, Event Marker Rows) in Segment Order
+def JoinRun(Results, PartPaths, CSVPath):
+  # Write CSV Header then Join Converted Segments
+  with open(CSVPath, 'w', newline='') as CSVFile:
+    DictWriter(
+      CSVFile,
+      fieldnames=Results[0][0],
+      lineterminator='\r\n'
+    ).writeheader()
+
+    # Slow Scans Completed After a Segment Switch Predate the End of the
+    # Previous Segment, so Overlapping Segments are Merged by Row Time
+    Spans = [Span for Span in map(PartSpan, PartPaths) if Span]
+    if any(Next[0] < Previous[1] for Previous, Next in zip(Spans, Spans[1:])):
+      PartFiles = [open(PartPath, 'r', newline='') for PartPath in PartPaths]
+      CSVFile.writelines(merge(*PartFiles, key=RowTime))
+      for PartFile in PartFiles:
+        PartFile.close()
+    else:
+      for PartPath in PartPaths:
+        with open(PartPath, 'r', newline='') as PartFile:
+          copyfileobj(PartFile, CSVFile)
+
+    for PartPath in PartPaths:
+      remove(PartPath)
+
+  # Join Event Markers of All Segments
+  EventTable = [event for result in Results for event in result[1]]
+
+  # Write Event Markers Next to the CSV File
+  if EventTable:
+    EventPath = splitext(CSVPath)[0] + '_EV.csv'
+    print('Event File Location: ' + EventPath)
+
+    with open(EventPath, 'w', newline='') as EventFile:
+      TableWriter = DictWriter(
+        EventFile,
+        fieldnames=EVENT_FIELDS,
+        lineterminator='\r\n'
+      )
+
+      TableWriter.writeheader()
+      TableWriter.writerows(EventTable)
+
+
+# Finds Runs to Convert in a Folder, Skipping Up to Date Outputs
+# Returns (Segments, Output Path) for Each Run, Named N.csv After N.dat
+# Other Exporters Pass their Own Output Extension
+def FindRuns(Folder, Force = False, Extension = '.csv'):
+  Runs = []
+
+  for LogPath in sorted(glob(join(Folder, '*.[dD][aA][tT]'))):
+    # Later Segments are Converted with their Run's 1st Segment
+    if fullmatch(r'\d+_\d+\.dat', basename(LogPath), IGNORECASE):
       continue
 
-    # Process Each ADC Sample in the DMA buffer in Blocks
-    for index in range(0, len(data), ADC_PARALLEL_CHANNELS):
-      # Clear Dictionary Buffer
-      CurrentRow = {}
-
-      # Calculate the TimeStamp for the Current Row of Samples
-      CurrentRow.update({
-        'Time (us)':
-        int((((TimeStamp - LastTime) * index) / len(data)) + LastTime)
-      })
-
-      # Deinterleave and Append ADC Sample Data to Dictionary
-      # NOTE : See Interfaces.hpp
-      for channel in range(ADC_PARALLEL_CHANNELS):
-        # Decode Data From A0 Onwards in Pinout
-        CurrentRow.update(
-          {'A' + str(channel) : data[index + channel]}
-        )
+    Segments = FindSegments(LogPath)
+    CSVPath = splitext(LogPath)[0] + Extension
 
-      # Append Converted ADC Sample Data to Table
-      CSVDataTable.append(CurrentRow)
+    # Output is Up to Date if Written After Every Segment
+    if not Force and exists(CSVPath) and \
+       getmtime(CSVPath) >= max(getmtime(Segment) for Segment in Segments):
+      print('Up to Date: ' + basename(CSVPath))
+      continue
 
-    # Update the TimeStamp for the Next Block
-    LastTime = TimeStamp
+    Runs.append((Segments, CSVPath))
+
+  return Runs
+
+
+# Converts Every Run in a Folder Concurrently without Dialogs
+# All Segments Share One Queue, Largest First, so Idle Workers
+# Take the Next Largest Piece and Large Runs Spread Across Cores
+def ConvertBatch(Folder, Workers = None, Force = False, Stream = False):
+  Runs = FindRuns(Folder, Force)
+  if not Runs:
+    print('No Logs to Convert')
+    return
+
+  # One Task per Segment, Ordered by Size
+  Tasks = [
+    (getsize(LogPath), Run, Index)
+    for Run, (Segments, _) in enumerate(Runs)
+    for Index, LogPath in enumerate(Segments)
+  ]
+  Tasks.sort(reverse=True)
+
+  PartPaths = [
+    [CSVPath + '.part' + str(Index) for Index in range(len(Segments))]
+    for Segments, CSVPath in Runs
+  ]
+  Results = [[None] * len(Segments) for Segments, _ in Runs]
+  Pending = [len(Segments) for Segments, _ in Runs]
+  Failed = set()
+  Summary = []
+
+  Start = perf_counter()
+  with ProcessPoolExecutor(max_workers=Workers) as Pool:
+    Futures = {
+      Pool.submit(TimeSegment, Runs[Run][0][Index], PartPaths[Run][Index], Stream): (Run, Index)
+      for _, Run, Index in Tasks
+    }
+
+    # Join Each Run as Soon as its Last Segment Finishes
+    for Future in as_completed(Futures):
+      Run, Index = Futures[Future]
+      Segments, CSVPath = Runs[Run]
+      Pending[Run] -= 1
+
+      try:
+        Results[Run][Index] = Future.result()
+      except Exception as Error:
+        print('!!!! Conversion Failed: ' + Segments[Index] + ': ' + str(Error))
+        Failed.add(Run)
+
+      if Pending[Run]:
+        continue
+
+      # Discard Parts of Failed Runs
+      if Run in Failed:
+        for PartPath in PartPaths[Run]:
+          if exists(PartPath):
+            remove(PartPath)
+        continue
+
+      JoinRun([Result[0:2] for Result in Results[Run]], PartPaths[Run], CSVPath)
+
+      Size = sum(getsize(Segment) for Segment in Segments)
+      Seconds = sum(Result[2] for Result in Results[Run])
+      Summary.append((basename(Segments[0]), len(Segments), Size, Seconds))
+
+  Elapsed = perf_counter() - Start
+
+  # Per File Throughput, Seconds are Worker Time Spent on the Run
+  print('')
+  print('>> Batch Summary')
+  print('{:<16} {:>8} {:>10} {:>10} {:>10}'.format('Log', 'Segments', 'MB', 'Seconds', 'MB/s'))
+  for Name, Count, Size, Seconds in Summary:
+    print('{:<16} {:>8} {:>10.2f} {:>10.2f} {:>10.2f}'.format(
+      Name, Count, Size / 1e6, Seconds, Size / 1e6 / Seconds
+    ))
+
+  Total = sum(Size for _, _, Size, _ in Summary)
+  print('')
+  print('Converted {} of {} Runs, {:.2f} MB in {:.2f} s, {:.2f} MB/s'.format(
+    len(Summary), len(Runs), Total / 1e6, Elapsed, Total / 1e6 / Elapsed
+  ))
+
+
+if __name__ == '__main__':
+  Parser = ArgumentParser(description='FireSide Binary Data File Convertor')
+  Parser.add_argument('--batch', metavar='FOLDER', help='Convert Every Log in FOLDER without Dialogs')
+  Parser.add_argument('--workers', type=int, default=cpu_count(), help='Worker Processes in Batch Mode')
+  Parser.add_argument('--force', action='store_true', help='Convert Logs with Up to Date CSV Files')
+  Parser.add_argument('--stream', action='store_true', help='Vectorised Streaming Conversion in Batch Mode, Same CSV Output')
+  Parser.add_argument('--format', choices=['csv', 'npy', 'raw'], default='csv', help='Batch Output, Columnar Formats are Written by ExportLog.py')
+  Options = Parser.parse_args()
+
+  if Options.batch:
+    print('#########')
+    print('FireSide Binary Data File Convertor, Batch Mode')
+    print('#########')
+    print('')
+
+    # Columnar Export Imports this Module, so Load it Only When Needed
+    if Options.format != 'csv':
+      from ExportLog import ExportBatch
+      ExportBatch(Options.batch, Options.format, 'float32', Options.workers, Options.force)
+      exit()
+
+    ConvertBatch(Options.batch, Options.workers, Options.force, Options.stream)
+    exit()
+
+  # Display Script Startup
+  print('#########')
+  print('FireSide Binary Data File Convertor')
+  print('#########')
+  print('')
+
+
+  # User Interaction for File Location and Status Updates
+  # Imported Here so Batch Mode, Workers and Importing Scripts Run Without Tk
+  from tkinter import filedialog, messagebox, Tk
+
+  # Create Background Window Context for TKinter
+  context = Tk()
+  context.withdraw()
+
+
+  # Print Configuration and Notify User
+  print('>> Converter Settings')
+  print('ADC Parallel Channels: ' + str(ADC_PARALLEL_CHANNELS))
+  print('ADC Channel Map: ' + ', '.join(ADC_CHANNEL_LABELS))
+  print('ADC DMA Block Size: ' + str(ADC_DMA_BLOCKLEN))
+  print('')
+
+
+  # Ask User for Path to Input Binary File
+  print('>> Input File Path [Select in Popup]')
+  LogPath = filedialog.askopenfilename(
+    title='Select Binary Log File',
+    filetypes=[('FireSide Binary Log Files', '*.DAT')]
+  )
+  print('File Location: ' + str(LogPath))
 
+  if not LogPath:
+    print('No File Found at Specified Path')
+    messagebox.showerror(
+      title='Binary Input File Not Found',
+      message=str(LogPath) + ' is Not Valid'
+    )
+    exit()
 
+  # Treat All Segments of the Selected Run as One Log
+  Segments = FindSegments(LogPath)
+  print('Run Segments: ' + str(len(Segments)))
 
-# Ask User for Path to Output Binary File
-print('>> Output File Path [Select in Popup]')
-CSVPath = filedialog.asksaveasfilename(
-  title='Input CSV File Name',
-  filetypes=[('FireSide CSV Log Files', '*.CSV')]
-)
-print('CSV File Location: ' + str(CSVPath))
 
-if not CSVPath:
-  print('Specified Path is Not Accessible')
-  messagebox.showerror(
-    title='CSV Output File Name Error',
-    message=str(CSVPath) + ' is Not Valid'
+  # Ask User for Path to Output Binary File
+  print('>> Output File Path [Select in Popup]')
+  CSVPath = filedialog.asksaveasfilename(
+    title='Input CSV File Name',
+    filetypes=[('FireSide CSV Log Files', '*.CSV')]
   )
-  exit()
+  print('CSV File Location: ' + str(CSVPath))
 
+  if not CSVPath:
+    print('Specified Path is Not Accessible')
+    messagebox.showerror(
+      title='CSV Output File Name Error',
+      message=str(CSVPath) + ' is Not Valid'
+    )
+    exit()
 
-# Write Converted Data to Selected CSV File
-with open(CSVPath, 'w') as CSVFile:
-  TableWriter = DictWriter(
-    CSVFile,
-    fieldnames=CSVDataTable[0].keys(),
-    lineterminator='\r\n'
-  )
-
-  # Write CSV Header
-  TableWriter.writeheader()
 
-  # Write Converted Data
-  TableWriter.writerows(CSVDataTable)
+  # Convert and Write Selected Run to CSV File
+  print('>> Reading and Converting Binary File')
+  ConvertRun(Segments, CSVPath)
@@ -13,16 +13,81 @@
 // DMA Data Logging Function Prototypes
 #include "DMADAQ.hpp"
 
+// Binary Logfile Record Definitions
+#include "LogFormat.hpp"
+
+// Event Marker Queue
+#include "Events.hpp"
+
+// Sync Pulse Edge Capture
+#include "Sync.hpp"
+
 
 // #### Internal Definitions
 // Analog Pin Readout Buffer
 uint16_t ReadoutBuffer[ADC_PARALLEL_CHANNELS];
 
+// ARM Self Test Limits in Raw 12-Bit Counts
+// Both Limits Scale with High Resolution Samples
+// Channels Averaging Within the Rail Margin are Saturated
+// Channels Noisier than the Floating Limit are Disconnected
+// NOTE: Tune Floating Limit Above the Noise Floor of Connected Sensors
+#define SELFTEST_RAIL_MARGIN 8U
+#define SELFTEST_FLOATING_STD 20U
+
+// ARM Self Test Burst Timeout
+// Burst Fills the Whole Circular Buffer, 2 Block Periods, See Planner Below
+// Margin Covers ADC Enable and DMA Start Before the 1st Scan (ms)
+#define SELFTEST_MARGIN_MS 50UL
+#define SELFTEST_TIMEOUT_US (2ULL * ADC_BLOCK_PERIOD_US + SELFTEST_MARGIN_MS * 1000ULL)
+
+// Quick-Look Threshold Above Self Test Baseline in Raw 12-Bit Counts
+// Samples Count Towards Impulse and Time Above Threshold Only Past the
+// Larger of the Fixed Rise and the Multiple of Baseline Noise
+#define QUICKLOOK_MIN_RISE 40U
+#define QUICKLOOK_SIGMAS 6U
+
 
 // ADC DMA Buffer Block Length
 // Align Block to SD Card 512 Byte Boundary to Optimise IO
 #define ADC_DMA_BLOCKLEN (ADC_PARALLEL_CHANNELS * 512)
 
+
+// #### Acquisition Throughput Planner
+// Nominal Regular Scan Period in Nanoseconds and Per Channel Sample Rate
+// See ADCConversionTiming in Channels.hpp for the Formula
+#define ADC_SCAN_PERIOD_NS (ADCConversion::ScanPeriodNS<ADCLoggedChannels>())
+#define ADC_SAMPLE_RATE_HZ (1000000000UL / ADC_SCAN_PERIOD_NS)
+
+// Time to Fill One DMA Block, the Longest an SD Write may Take
+#define ADC_BLOCK_PERIOD_US ((uint64_t)ADC_SCAN_PERIOD_NS * 512ULL / 1000ULL)
+
+// Logged Bytes per Second Including Record Headers and Slow Scans
+#define ADC_LOG_BYTES_PER_S ( \
+  (uint64_t)(ADC_DMA_BLOCKLEN * 2UL + 8UL) * 1000000ULL / ADC_BLOCK_PERIOD_US + \
+  (ADC_SLOW_PERIOD_US ? (4ULL + 2ULL * ADC_SLOW_CHANNELS) * 1000000ULL / (ADC_SLOW_PERIOD_US ? ADC_SLOW_PERIOD_US : 1UL) : 0ULL) \
+)
+
+// SD Card Limits, Tune with EVENT_SD_HIGHWATER Write Times from Bench Runs
+// Sustained Rate of Back to Back Block Writes, and Longest Single Write Stall
+#define SD_SUSTAINED_BYTES_PER_S 300000ULL
+#define SD_WRITE_STALL_US 50000ULL
+
+static_assert(
+  ADC_LOG_BYTES_PER_S <= SD_SUSTAINED_BYTES_PER_S,
+  "Logged Data Rate Exceeds Sustained SD Card Write Rate"
+);
+static_assert(
+  ADC_BLOCK_PERIOD_US >= SD_WRITE_STALL_US,
+  "DMA Block Fills Faster than the Longest SD Card Write Stall"
+);
+
+// Rotate Binary Logfile into Fixed Size Segments
+// Segments are Named N.dat, N_1.dat, N_2.dat, ... Under Run ID N
+// Keeps Files Well Below the FAT32 4 GB Limit and Isolates Corruption
+// #define USE_LOG_SEGMENTS
+#define LOG_SEGMENT_BYTES (64UL * 1024UL * 1024UL)
+
 // Circular DMA Buffer Data Storage Structure
 // By Convention, Circular DMA Buffers are 2 Blocks Long
 uint16_t DMABuffer[2 * ADC_DMA_BLOCKLEN];
@@ -32,6 +97,10 @@ uint16_t DMABuffer[2 * ADC_DMA_BLOCKLEN];
 // Updated in Half and Full Transfer Complete Callbacks
 uint16_t *SDWriteBlockStart;
 
+// Timestamp of Latest Finalised Block in Microseconds
+// Captured in Half and Full Transfer Complete Callbacks
+volatile uint32_t SDWriteBlockTime;
+
 // Boolean to Track Current Block Write Status
 volatile bool SDWriteBlockReady;
 
@@ -45,10 +114,109 @@ volatile bool SDLogStop;
 volatile bool SDWriteError;
 
 
+// Boolean to Track Active Acquisition
+// ADC Faults are Only Recovered While Logging
+volatile bool ADCLogging;
+
+// Boolean to Defer Acquisition Restart to Logging Loop
+// Set When Restarting Would Overwrite a Block Still Being Written
+volatile bool ADCRestartPending;
+
+// Fault Counters for Post Logging Report
+volatile uint32_t ADCOverruns;
+volatile uint32_t DMAErrors;
+volatile uint32_t LostScans;
+
+// Acquisition Gap Awaiting Write to Logfile
+// Faults Before the Gap is Written are Merged into It
+LogGapRecord PendingGap;
+volatile bool GapOpen;
+volatile bool GapReady;
+
+
+// Binary Logfile, Opened and Primed in ARM Ahead of LAUNCH
+File SDLogFile;
+
+// Binary Logfile Name of the Current Run, Blank Until Selected
+String SDLogFileName;
+
+// Set Only if the Current ARM Created the Binary Logfile
+bool SDLogCreated;
+
+// Launch Latency Timestamps in Microseconds
+// Acquisition Start, Igniter Assertion and 1st Regular Block Stored
+uint32_t AcquisitionStartTime;
+uint32_t IgnitionTime;
+uint32_t FirstBlockStoredTime;
+
+#ifdef USE_ISR_BENCHMARK
+// DMA Interrupt Timing in Core Cycles
+// Updated Only by the DMA Interrupt, Read After Logging Stops
+struct ISRTiming {
+  uint32_t calls;
+  uint32_t low;
+  uint32_t high;
+  uint64_t sum;
+  uint64_t squares;
+  uint32_t last;
+  uint32_t periodlow;
+  uint32_t periodhigh;
+};
+ISRTiming DMAISRTiming;
+#endif
+
+// Quick-Look Burn Statistics per Logged Channel
+// Updated Block by Block in the Logging Loop, Reported When Logging Stops
+// Baseline and Threshold are Set by the ARM Self Test
+struct QuickLookChannel {
+  uint16_t baseline;
+  uint16_t threshold;
+  uint16_t peak;
+  uint32_t peaktime;
+  uint64_t area;
+  uint64_t above;
+};
+QuickLookChannel QuickLook[ADC_PARALLEL_CHANNELS];
+
+// Regular Blocks Written and Microseconds They Span
+uint32_t QuickLookBlocks;
+uint32_t QuickLookSpan;
+
+
+// Injected Scan Buffer Block Length in Scans
+// Keep Slow Blocks Small to Bound Latency to the SD Card
+#define ADC_SLOW_BLOCKSCANS (ADC_SLOW_CHANNELS ? 64 : 0)
+
+// Injected Scan Data Storage Structure
+// Each Scan is Timestamped When its Conversions Complete
+struct __attribute__((packed)) SlowScan {
+  uint32_t time;
+  uint16_t samples[ADC_SLOW_CHANNELS];
+};
+
+// Double Buffered Injected Scan Storage
+// Filled One Scan at a Time in Injected Conversion Callback
+SlowScan SlowBuffer[2 * ADC_SLOW_BLOCKSCANS];
+
+// Index of Next Scan to Fill in Injected Scan Buffer
+volatile uint16_t SlowScanIndex;
+
+// Pointer to Finalised Block in Injected Scan Buffer
+SlowScan *SlowWriteBlockStart;
+
+// Boolean to Track Injected Block Write Status
+volatile bool SlowWriteBlockReady;
+
+
 // ADC and DMA Interface using STM32 HAL
 ADC_HandleTypeDef hadc1;
 DMA_HandleTypeDef hdma_adc1;
 
+#ifdef USE_SLOW_CHANNELS
+// Injected Scan Trigger Timer using STM32 HAL
+TIM_HandleTypeDef htim15;
+#endif
+
 
 // #### Hardware Configuration Functions
 // DMA Module Configuration
@@ -81,7 +249,7 @@ void ConfigureDMA(bool Continuous)
   hdma_adc1.Init.Mode = DMA_CIRCULAR;
 
   // Write Settings to DMA Module
-  if (HAL_DMA_Init(&hdma_adc1) != HAL_OK)
+  if (TraceHAL(__LINE__, HAL_DMA_Init(&hdma_adc1)) != HAL_OK)
   {
     ErrorBlink(ERR_HAL_DMA);
   }
@@ -95,74 +263,255 @@ void ConfigureDMA(bool Continuous)
 }
 
 
+#ifdef USE_ISR_BENCHMARK
+// Record DMA Interrupt Duration and Spacing in Core Cycles
+// Called Last in the Handler, so its Own Cost is Not Counted
+void TimeDMAInterrupt(uint32_t Entry)
+{
+  uint32_t cycles = DWT->CYCCNT - Entry;
+
+  DMAISRTiming.calls++;
+  DMAISRTiming.sum += cycles;
+  DMAISRTiming.squares += (uint64_t)cycles * cycles;
+  DMAISRTiming.low = (cycles < DMAISRTiming.low) ? cycles : DMAISRTiming.low;
+  DMAISRTiming.high = (cycles > DMAISRTiming.high) ? cycles : DMAISRTiming.high;
+
+  // Spacing of Consecutive Entries, Restarted After Each Gap
+  if (DMAISRTiming.last)
+  {
+    uint32_t period = Entry - DMAISRTiming.last;
+    DMAISRTiming.periodlow = (period < DMAISRTiming.periodlow) ? period : DMAISRTiming.periodlow;
+    DMAISRTiming.periodhigh = (period > DMAISRTiming.periodhigh) ? period : DMAISRTiming.periodhigh;
+  }
+  DMAISRTiming.last = Entry;
+}
+#endif
+
+
 // Handle DMA1 Channel1 Global Interrupt for ADC Callbacks
 extern "C" void DMA1_Channel1_IRQHandler()
 {
+#ifdef USE_ISR_BENCHMARK
+  uint32_t entry = DWT->CYCCNT;
+#endif
+
+#ifdef USE_LL_DMA_IRQ
+  // Handle Block Flags by Register Access, in HAL_DMA_IRQHandler Order
+  // Skips HAL Handle Lookups, State Updates and Callback Indirection
+  // See Section 11.6 in ST's RM0394 Manual For DMA Flag Registers
+  uint32_t flags = DMA1->ISR;
+  if (flags & DMA_ISR_HTIF1)
+  {
+    DMA1->IFCR = DMA_IFCR_CHTIF1;
+    CompleteBlock(DMABuffer);
+  }
+  else if (flags & DMA_ISR_TCIF1)
+  {
+    DMA1->IFCR = DMA_IFCR_CTCIF1;
+    CompleteBlock(&DMABuffer[ADC_DMA_BLOCKLEN]);
+  }
+  else
+  {
+    // Transfer Errors are Rare, HAL Disables the Channel and Reports them
+    HAL_DMA_IRQHandler(&hdma_adc1);
+  }
+#else
   HAL_DMA_IRQHandler(&hdma_adc1);
+#endif
+
+#ifdef USE_ISR_BENCHMARK
+  TimeDMAInterrupt(entry);
+#endif
 }
 
 
-// Successful Block One DMA Transfer Completion Callback
-void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+// Hand Completed DMA Block to the Logging Loop
+// Shared by HAL Callbacks and the Register Level Interrupt Handler
+void CompleteBlock(uint16_t *Block)
 {
-  // Check If Previous Block is Still Being Written
-  // Otherwise Check for Logging Finish Signal
-  if (SDWriting || SDLogStop)
+  // Previous Block is Still Being Written, or was Never Picked Up
+  // While the Logging Loop Stalled on Other Records or Commands
+  // The Self Test Burst Leaves Blocks Unread, so Only Logging Counts
+  bool overrun = SDWriting || (ADCLogging && SDWriteBlockReady);
+
+  // Check for Overrun or Logging Finish Signal
+  if (overrun || SDLogStop)
   {
     // Stop ADC Conversion
-    HAL_ADC_Stop_DMA(&hadc1);
+    TraceHAL(__LINE__, HAL_ADC_Stop_DMA(&hadc1));
 
-    // If Previous Block Write is Incomplete
-    if (SDWriting)
+    // If Previous Block was Not Stored
+    if (overrun)
     {
       // Signal SD Buffer Write Error
       SDWriteError = true;
     }
   }
 
-  // Reset Block Write Pointer to 1st Block in the Circular Buffer
-  SDWriteBlockStart = DMABuffer;
+  // Point Block Write Pointer to Completed Block in the Circular Buffer
+  SDWriteBlockStart = Block;
+
+  // Timestamp Block on Completion
+  SDWriteBlockTime = micros();
 
   // Update Block Write Status for Logging Routine
   SDWriteBlockReady = true;
 }
 
 
+// Successful Block One DMA Transfer Completion Callback
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+  CompleteBlock(DMABuffer);
+}
+
+
 // Successful Block Two DMA Transfer Completion Callback
 void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
 {
-  // Check If Previous Block is Still Being Written
-  // Otherwise Check for Logging Finish Signal
-  if (SDWriting || SDLogStop)
+  CompleteBlock(&DMABuffer[ADC_DMA_BLOCKLEN]);
+}
+
+
+#ifdef USE_SLOW_CHANNELS
+// Injected Scan Conversion Completion Callback
+void HAL_ADCEx_InjectedConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+  // Timestamp and Store Injected Scan in Next Free Slot
+  SlowScan &scan = SlowBuffer[SlowScanIndex];
+  scan.time = micros();
+
+  // Read Each Injected Rank in Scan Order
+  ADCSlowChannels::ForEach([&](uint8_t position, uint8_t input) {
+    scan.samples[position] = (uint16_t)(
+      HAL_ADCEx_InjectedGetValue(hadc, ADCInjectedRanks[position])
+    );
+  });
+
+  // Advance to Next Scan and Check for Block Completion
+  SlowScanIndex++;
+  if (SlowScanIndex % ADC_SLOW_BLOCKSCANS != 0)
   {
-    // Stop ADC Conversion
-    HAL_ADC_Stop_DMA(&hadc1);
+    return;
+  }
 
-    // If Previous Block Write is Incomplete
-    if (SDWriting)
-    {
-      // Signal SD Buffer Write Error
-      SDWriteError = true;
-    }
+  // Previous Injected Block Must be Written Before Finalising Another
+  if (SlowWriteBlockReady)
+  {
+    SDWriteError = true;
   }
 
-  // Reset Block Write Pointer to 2nd Block in the Circular Buffer
-  SDWriteBlockStart = &DMABuffer[ADC_DMA_BLOCKLEN];
+  // Point to Block which was Just Completed
+  // Wrap Around to 1st Block at End of Buffer
+  SlowWriteBlockStart = &SlowBuffer[SlowScanIndex - ADC_SLOW_BLOCKSCANS];
+  if (SlowScanIndex == 2 * ADC_SLOW_BLOCKSCANS)
+  {
+    SlowScanIndex = 0;
+  }
 
-  // Update Block Write Status for Logging Routine
-  SDWriteBlockReady = true;
+  // Update Injected Block Write Status for Logging Routine
+  SlowWriteBlockReady = true;
 }
+#endif
 
 
 // ADC Conversion Error Callback
+// Handles Overruns and DMA Transfer Errors
 void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc)
 {
-  UNUSED(hadc);
+  uint32_t error = HAL_ADC_GetError(hadc);
+
+  // Mark Fault in Log Event Stream
+  PostEvent(EVENT_ADC_ERROR, error);
+
+  // Record Block Write Status at the Fault for Post-Mortem Dumps
+  Trace(
+    TRACE_ADC_ERROR, 0,
+    (SDWriting ? TRACE_FLAG_WRITING : 0) | (SDWriteBlockReady ? TRACE_FLAG_READY : 0),
+    error
+  );
+
+  // Faults Outside of Logging Remain Fatal
+  if (!ADCLogging || SDLogStop)
+  {
+    ErrorBlink(ERR_HAL_ADC);
+  }
 
-  ErrorBlink(ERR_HAL_ADC);
+  // Count Faults by Type
+  if (error & HAL_ADC_ERROR_OVR)
+  {
+    ADCOverruns++;
+  }
+  if (error & HAL_ADC_ERROR_DMA)
+  {
+    DMAErrors++;
+  }
+
+  // Halt Conversions and DMA Requests
+  // The Partially Filled Block is Discarded
+  TraceHAL(__LINE__, HAL_ADC_Stop_DMA(&hadc1));
+
+  // Open Gap at End of Last Complete Block
+  // Merge with Gap Still Awaiting Write
+  if (!GapOpen)
+  {
+    PendingGap.start = SDWriteBlockTime;
+    PendingGap.fault = micros();
+    PendingGap.error = 0;
+    PendingGap.faults = 0;
+    GapOpen = true;
+  }
+  PendingGap.error |= error;
+  PendingGap.faults++;
+  GapReady = false;
+
+  // Restart Immediately Unless 1st Block is Still Being Written
+  // DMA Always Restarts Filling the 1st Block of the Circular Buffer
+  if ((SDWriting || SDWriteBlockReady) && SDWriteBlockStart == DMABuffer)
+  {
+    ADCRestartPending = true;
+  } else {
+    RestartAcquisition();
+  }
+}
+
+
+// Restart ADC DMA Transfer After a Fault
+void RestartAcquisition()
+{
+  ADCRestartPending = false;
+
+  // Restart Regular Scans from Start of Circular Buffer
+  TraceHAL(__LINE__, HAL_ADC_Start_DMA(
+    &hadc1,
+    (uint32_t *)DMABuffer,
+    sizeof(DMABuffer) / sizeof(uint16_t)
+  ));
+
+#ifdef USE_SLOW_CHANNELS
+  // Rearm Injected Group, its Trigger Timer Keeps Running
+  HAL_ADCEx_InjectedStart_IT(&hadc1);
+#endif
+
+  // Close Gap and Estimate Scans Lost Since Last Complete Block
+  PendingGap.resume = micros();
+  PendingGap.lostscans = (uint32_t)(
+    ((uint64_t)(PendingGap.resume - PendingGap.start) * 1000UL) / ADC_SCAN_PERIOD_NS
+  );
+
+  // Next Block Starts at Restart Time
+  SDWriteBlockTime = PendingGap.resume;
+
+#ifdef USE_ISR_BENCHMARK
+  // Interrupt Spacing Across the Gap is Not Jitter
+  DMAISRTiming.last = 0;
+#endif
+
+  GapReady = true;
 }
 
 
+
 // ADC Module Configuration
 void ConfigureADC(bool Continuous)
 {
@@ -174,10 +523,10 @@ void ConfigureADC(bool Continuous)
   // Select ADC Module One on MCU
   hadc1.Instance = ADC1;
 
-  // Sync ADC to Core Clock: 80 MHz / 4 = 20 MHz
+  // Sync ADC to Core Clock: 80 MHz / 4 = 20 MHz by Default
   // Max Allowable Clock at 12-Bit Resolution
   // See Page 384 in ST's RM0394 Manual For More Implementation Details
-  hadc1.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV4;
+  hadc1.Init.ClockPrescaler = ADCConversion::prescaler;
 
   // Setup ADC 12-Bit Data Resolution
   hadc1.Init.Resolution = ADC_RESOLUTION_12B;
@@ -186,9 +535,10 @@ void ConfigureADC(bool Continuous)
   // Total Sampling Speed:
   // ADC Clock / (Oversampling Ratio * No. of Channels * Cycles per Sample)
   // See Channel Configuration for Cycles per Sample
+  // Ratio and Shift Set the Stored Sample Resolution, See Interfaces.hpp
   hadc1.Init.OversamplingMode = ENABLE;
-  hadc1.Init.Oversampling.Ratio = ADC_OVERSAMPLING_RATIO_8;
-  hadc1.Init.Oversampling.RightBitShift = ADC_RIGHTBITSHIFT_3;
+  hadc1.Init.Oversampling.Ratio = ADCConversion::RatioCode();
+  hadc1.Init.Oversampling.RightBitShift = ADCConversion::ShiftCode();
 
   // Instruct ADC to Scan Input Pins in Sequence
   hadc1.Init.NbrOfConversion = ADC_PARALLEL_CHANNELS;
@@ -221,7 +571,7 @@ void ConfigureADC(bool Continuous)
   }
 
   // Write Settings to ADC Module
-  if (HAL_ADC_Init(&hadc1) != HAL_OK)
+  if (TraceHAL(__LINE__, HAL_ADC_Init(&hadc1)) != HAL_OK)
   {
     ErrorBlink(ERR_HAL_ADC);
   }
@@ -231,27 +581,36 @@ void ConfigureADC(bool Continuous)
   sConfig.SingleDiff = ADC_SINGLE_ENDED;
   sConfig.OffsetNumber = ADC_OFFSET_NONE;
 
-  // Configure Channel Sample Time
-  // NOTE: Cycles per Sample = 12.5 + Sampling Cycles
-  sConfig.SamplingTime = ADC_SAMPLETIME_92CYCLES_5;
-
-  // Loop Over All ADC Inputs and Write their Settings to the ADC
-  // See Interfaces.hpp for ADC Hardware Setup Definition
-  for (short input = 0; input < ADC_PARALLEL_CHANNELS; input++)
-  {
+  // Loop Over All Logged ADC Inputs and Write their Settings to the ADC
+  // See Interfaces.hpp for ADC Hardware Setup and Channel Map Definitions
+  ADCLoggedChannels::ForEach([&](uint8_t position, uint8_t input) {
     // Configure GPIO Input Pin to Analog Mode
     pinMode(ADCHardwareSetup[input].pin, INPUT_ANALOG);
 
-    // Assign Hardware Input Channel to ADC Rank
+    // Assign Hardware Input Channel to ADC Rank in Scan Order
     sConfig.Channel = ADCHardwareSetup[input].channel;
-    sConfig.Rank = ADCHardwareSetup[input].rank;
+    sConfig.Rank = ADCRegularRanks[position];
+
+    // Configure Channel Sample Time
+    // NOTE: Cycles per Sample = 12.5 + Sampling Cycles
+    sConfig.SamplingTime = ADCLoggedChannels::sampletimes[position];
 
     // Write Settings to Each ADC Input Channel
-    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+    if (TraceHAL(__LINE__, HAL_ADC_ConfigChannel(&hadc1, &sConfig)) != HAL_OK)
     {
       ErrorBlink(ERR_HAL_ADC);
     }
+  });
+
+  // Configure Injected Group for Slow Channels During Logging
+  // Injected Scans Interrupt the Regular Sequence on Each Timer Trigger
+  // See Page 400 in ST's RM0394 Manual For More Implementation Details
+#ifdef USE_SLOW_CHANNELS
+  if (Continuous)
+  {
+    ConfigureSlowChannels();
   }
+#endif
 
   // Setup ADC Global Interrupt
   // Select Lower Priority than DMA Channel Interrupt
@@ -260,6 +619,81 @@ void ConfigureADC(bool Continuous)
 }
 
 
+#ifdef USE_SLOW_CHANNELS
+// Injected Group and Trigger Timer Configuration for Slow Channels
+void ConfigureSlowChannels()
+{
+  ADC_InjectionConfTypeDef sConfigInjected;
+  TIM_MasterConfigTypeDef sMasterConfig;
+
+  // Set Single Ended Conversion with No Assumed Offset
+  sConfigInjected.InjectedSingleDiff = ADC_SINGLE_ENDED;
+  sConfigInjected.InjectedOffsetNumber = ADC_OFFSET_NONE;
+  sConfigInjected.InjectedOffset = 0;
+
+  // Convert Whole Injected Sequence on Each Timer 15 Trigger
+  sConfigInjected.InjectedNbrOfConversion = ADC_SLOW_CHANNELS;
+  sConfigInjected.InjectedDiscontinuousConvMode = DISABLE;
+  sConfigInjected.AutoInjectedConv = DISABLE;
+  sConfigInjected.QueueInjectedContext = DISABLE;
+  sConfigInjected.ExternalTrigInjecConv = ADC_EXTERNALTRIGINJEC_T15_TRGO;
+  sConfigInjected.ExternalTrigInjecConvEdge = ADC_EXTERNALTRIGINJECCONV_EDGE_RISING;
+
+  // Oversampling Ratio and Shift are Shared with the Regular Group in CFGR2
+  // Write the Regular Group's Settings Back so Sample Resolution is Unchanged
+  sConfigInjected.InjecOversamplingMode = ENABLE;
+  sConfigInjected.InjecOversampling.Ratio = ADCConversion::RatioCode();
+  sConfigInjected.InjecOversampling.RightBitShift = ADCConversion::ShiftCode();
+
+  // Loop Over All Slow ADC Inputs and Write their Settings to the ADC
+  // See Interfaces.hpp for ADC Hardware Setup and Channel Map Definitions
+  ADCSlowChannels::ForEach([&](uint8_t position, uint8_t input) {
+    // Configure GPIO Input Pin to Analog Mode
+    pinMode(ADCHardwareSetup[input].pin, INPUT_ANALOG);
+
+    // Assign Hardware Input Channel to Injected Rank in Scan Order
+    sConfigInjected.InjectedChannel = ADCHardwareSetup[input].channel;
+    sConfigInjected.InjectedRank = ADCInjectedRanks[position];
+    sConfigInjected.InjectedSamplingTime = ADCSlowChannels::sampletimes[position];
+
+    // Write Settings to Each Injected Input Channel
+    if (TraceHAL(__LINE__, HAL_ADCEx_InjectedConfigChannel(&hadc1, &sConfigInjected)) != HAL_OK)
+    {
+      ErrorBlink(ERR_HAL_ADC);
+    }
+  });
+
+  // Enable Clock to Timer 15
+  __HAL_RCC_TIM15_CLK_ENABLE();
+
+  // Count at 1 MHz and Overflow Once per Slow Period
+  htim15.Instance = TIM15;
+  htim15.Init.Prescaler = (SystemCoreClock / 1000000UL) - 1;
+  htim15.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim15.Init.Period = ADC_SLOW_PERIOD_US - 1;
+  htim15.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim15.Init.RepetitionCounter = 0;
+  htim15.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+
+  // Write Settings to Timer Module
+  if (TraceHAL(__LINE__, HAL_TIM_Base_Init(&htim15)) != HAL_OK)
+  {
+    ErrorBlink(ERR_HAL_ADC);
+  }
+
+  // Issue Trigger Output to ADC on Each Timer Overflow
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_UPDATE;
+  sMasterConfig.MasterOutputTrigger2 = TIM_TRGO2_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+
+  if (TraceHAL(__LINE__, HAL_TIMEx_MasterConfigSynchronization(&htim15, &sMasterConfig)) != HAL_OK)
+  {
+    ErrorBlink(ERR_HAL_ADC);
+  }
+}
+#endif
+
+
 // Handle ADC Global Interrupt for ADC Callbacks
 extern "C" void ADC1_IRQHandler()
 {
@@ -276,7 +710,7 @@ void ReadoutAnalogPins()
 
   // Calibrate ADC in Single Ended Input Mode Before Converting
   // See Errata 2.6.10 in ST's ES0456 Errata Document for L412KBU6U
-  if (HAL_ADCEx_Calibration_Start(&hadc1, ADC_SINGLE_ENDED) != HAL_OK)
+  if (TraceHAL(__LINE__, HAL_ADCEx_Calibration_Start(&hadc1, ADC_SINGLE_ENDED)) != HAL_OK)
   {
     ErrorBlink(ERR_HAL_ADC);
   }
@@ -286,13 +720,13 @@ void ReadoutAnalogPins()
   for (short channel = 0; channel < ADC_PARALLEL_CHANNELS; channel++)
   {
     // Start ADC for Single Scan of Input Pins
-    if (HAL_ADC_Start(&hadc1) != HAL_OK)
+    if (TraceHAL(__LINE__, HAL_ADC_Start(&hadc1)) != HAL_OK)
     {
       ErrorBlink(ERR_HAL_ADC);
     }
 
     // Wait 100 ms for Conversion Completion
-    if (HAL_ADC_PollForConversion(&hadc1, 100UL) != HAL_OK)
+    if (TraceHAL(__LINE__, HAL_ADC_PollForConversion(&hadc1, 100UL)) != HAL_OK)
     {
       ErrorBlink(ERR_HAL_ADC);
     }
@@ -302,43 +736,165 @@ void ReadoutAnalogPins()
   }
 
   // Stop ADC After Each Input Pin has been Read Out
-  if (HAL_ADC_Stop(&hadc1) != HAL_OK)
+  if (TraceHAL(__LINE__, HAL_ADC_Stop(&hadc1)) != HAL_OK)
   {
     ErrorBlink(ERR_HAL_ADC);
   }
 
-  // Assemble ADC Calibration Data and Channel Debug Data
-  String debug = "Calibration=";
-  debug += HAL_ADCEx_Calibration_GetValue(&hadc1, ADC_SINGLE_ENDED);
-  debug += ' ';
+  // Queue ADC Calibration Data and Channel Debug Data
+  // Raw Values are Sent with Full Scale, See ADC_SAMPLE_BITS
+  PostStatus(
+    STATUS_ADC_CALIBRATION,
+    {HAL_ADCEx_Calibration_GetValue(&hadc1, ADC_SINGLE_ENDED)}
+  );
+
+  ADCLoggedChannels::ForEach([&](uint8_t position, uint8_t input) {
+    PostStatus(STATUS_ADC_CHANNEL, {input, ReadoutBuffer[position], ADC_SAMPLE_MAX});
+  });
+}
+
+
+// Integer Square Root for Fixed Point Statistics
+uint32_t SquareRoot(uint64_t Value)
+{
+  uint64_t root = 0;
+  uint64_t bit = 1ULL << 62;
 
-  for(short channel = 0; channel < ADC_PARALLEL_CHANNELS; channel++)
+  // Find Highest Power of 4 Not Above Value
+  while (bit > Value)
   {
-    // Channel Label
-    // NOTE: See Interfaces.hpp
-    debug += 'A';
-    debug += channel;
+    bit >>= 2;
+  }
+
+  // Settle One Result Bit per Iteration
+  while (bit)
+  {
+    if (Value >= root + bit)
+    {
+      Value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return root;
+}
 
-    // Separator
-    debug += '=';
 
-    // Channel Value for 12-Bit Data
-    debug += (ReadoutBuffer[channel] * 3.3 / (1<<12));
+// Burst Sample Logged Channels through Continuous DMA and Check Inputs
+// Returns False if any Channel is Floating or Saturated
+bool SelfTestAnalogPins()
+{
+  // Number of Scans in Burst, One Full Circular DMA Buffer
+  const uint32_t scans = 2 * ADC_DMA_BLOCKLEN / ADC_PARALLEL_CHANNELS;
+
+  // Fill Circular DMA Buffer Once, as During Logging
+  // Full Transfer Callback Moves Block Pointer to the 2nd Block
+  SDWriteBlockStart = DMABuffer;
+  SDWriteBlockReady = false;
+
+  uint32_t start = micros();
+  TraceHAL(__LINE__, HAL_ADC_Start_DMA(
+    &hadc1,
+    (uint32_t *)DMABuffer,
+    sizeof(DMABuffer) / sizeof(uint16_t)
+  ));
 
-    // Value Units and Separator
-    debug += "V ";
+  while (SDWriteBlockStart == DMABuffer)
+  {
+    if ((micros() - start) > SELFTEST_TIMEOUT_US)
+    {
+      ErrorBlink(ERR_HAL_DMA);
+    }
   }
 
-  // Transmit ADC Channel Debug Data over RYLR
-  SendRYLR("ADC CHANNEL STATUS");
-  SendRYLR(debug);
+  uint32_t duration = micros() - start;
+  TraceHAL(__LINE__, HAL_ADC_Stop_DMA(&hadc1));
+
+  PostStatus(STATUS_ADC_BURST, {scans, duration});
+
+  // Accumulate Statistics per Channel in Fixed Point
+  // Mean, Deviation and Drift are Reported in Hundredths of a Count
+  bool pass = true;
+  ADCLoggedChannels::ForEach([&](uint8_t position, uint8_t input) {
+    uint32_t sum = 0;
+    uint32_t early = 0;
+    uint64_t squares = 0;
+    uint16_t low = 0XFFFFU;
+    uint16_t high = 0;
+
+    for (uint32_t scan = 0; scan < scans; scan++)
+    {
+      uint16_t sample = DMABuffer[scan * ADC_PARALLEL_CHANNELS + position];
+
+      sum += sample;
+      squares += (uint32_t)sample * sample;
+      low = (sample < low) ? sample : low;
+      high = (sample > high) ? sample : high;
+
+      // Sum 1st Half of Burst Separately for Drift
+      if (scan == scans / 2 - 1)
+      {
+        early = sum;
+      }
+    }
+
+    // Mean and Standard Deviation
+    // Variance Scaled by scans^2 Avoids Fractions: scans * squares - sum^2
+    uint32_t mean = ((uint64_t)sum * 100UL + scans / 2) / scans;
+    uint64_t spread = (uint64_t)scans * squares - (uint64_t)sum * sum;
+    uint32_t deviation = SquareRoot(spread * 10000UL) / scans;
+
+    // Drift as Change in Mean from 1st to 2nd Half of Burst
+    // Difference Times 200 Overflows 32 Bits with 16-Bit Bursts
+    int32_t drift = (((int64_t)(sum - early) - (int64_t)early) * 200LL) / (int64_t)scans;
+
+    PostStatus(
+      STATUS_ADC_SELFTEST,
+      {input, mean, deviation, low, high, ZigZag(drift)}
+    );
+
+    // Pinned to a Supply Rail
+    uint32_t margin = SELFTEST_RAIL_MARGIN << (ADC_SAMPLE_BITS - 12);
+    if (mean <= margin * 100UL ||
+        mean >= (ADC_SAMPLE_MAX - margin) * 100UL)
+    {
+      PostStatus(STATUS_ADC_SATURATED, {input});
+      pass = false;
+    }
+
+    // Input Follows Charge Left by Neighbouring Channels
+    if (deviation > (SELFTEST_FLOATING_STD << (ADC_SAMPLE_BITS - 12)) * 100UL)
+    {
+      PostStatus(STATUS_ADC_FLOATING, {input});
+      pass = false;
+    }
+
+    // Quick-Look Baseline and Threshold from the Rounded Mean
+    uint32_t baseline = (mean + 50UL) / 100UL;
+    uint32_t rise = QUICKLOOK_MIN_RISE << (ADC_SAMPLE_BITS - 12);
+    uint32_t noise = (QUICKLOOK_SIGMAS * deviation + 99UL) / 100UL;
+    uint32_t threshold = baseline + ((noise > rise) ? noise : rise);
+
+    QuickLook[position].baseline = baseline;
+    QuickLook[position].threshold = (threshold < ADC_SAMPLE_MAX) ? threshold : ADC_SAMPLE_MAX;
+  });
+
+  // Leave DMA Buffer as Configured for Logging
+  memset(DMABuffer, 0X00, sizeof(DMABuffer));
+  SDWriteBlockStart = DMABuffer;
+  SDWriteBlockReady = false;
+
+  return pass;
 }
 
 
 // Binary Logfile Name Helper
 String GetLogfileName(bool Initialise)
 {
-  static String FileName = "";
+  String &FileName = SDLogFileName;
 
   if (FileName.length() == 0 && Initialise)
   {
@@ -366,6 +922,34 @@ String GetLogfileName(bool Initialise)
 }
 
 
+// Forget the Current Run's Binary Logfile Name
+// The Next Call to GetLogfileName Selects a Fresh Name
+void ReleaseLogfileName()
+{
+  SDLogFileName = "";
+}
+
+
+// Binary Logfile Segment Name Helper
+String GetSegmentName(const String &LogName, uint16_t Segment)
+{
+  // 1st Segment Keeps the Run's Log File Name
+  if (Segment == 0)
+  {
+    return LogName;
+  }
+
+  // Build N_K.dat from N.dat
+  String SegmentName = LogName;
+  SegmentName.remove(SegmentName.lastIndexOf('.'));
+  SegmentName += '_';
+  SegmentName += Segment;
+  SegmentName += ".dat";
+
+  return SegmentName;
+}
+
+
 // Binary Logfile and Initial DMA Buffer Configuration
 void ConfigureLogging()
 {
@@ -377,14 +961,36 @@ void ConfigureLogging()
   // Initialise Current Block Status for SD Card Write
   SDWriteBlockReady = false;
 
+  // Initialise Injected Scan Buffer and Block Status
+  SlowScanIndex = 0;
+  SlowWriteBlockStart = SlowBuffer;
+  SlowWriteBlockReady = false;
+
   // Initialise SD Logging Stop Signal Boolean
   SDLogStop = false;
 
   // Initialise SD Write Buffer Error Signal Boolean
   SDWriteError = false;
 
+  // Initialise Fault Accounting
+  ADCLogging = ADCRestartPending = false;
+  GapOpen = GapReady = false;
+  ADCOverruns = DMAErrors = LostScans = 0;
+
   // Select a Fresh Filename for the Binary Logfile
+  // A Name Cached in SAFE is Dropped if a File has Since Taken It
+  String name = GetLogfileName(false);
+  if (name.length() && SD.exists(name))
+  {
+    ReleaseLogfileName();
+  }
   GetLogfileName(true);
+
+  // Report Planned Acquisition Rate and Resolution
+  PostStatus(
+    STATUS_ADC_PLAN,
+    {ADC_SAMPLE_RATE_HZ, ADC_SAMPLE_BITS, (uint32_t)ADC_LOG_BYTES_PER_S}
+  );
 }
 
 
@@ -401,40 +1007,422 @@ void TriggerLogging()
     RYLR.read();
   }
 
-  // Calibrate ADC in Single Ended Input Mode Before Triggering
-  // See Errata 2.6.10 in ST's ES0456 Errata Document for L412KBU6U
-  if (HAL_ADCEx_Calibration_Start(&hadc1, ADC_SINGLE_ENDED) != HAL_OK)
+  // ADC was Calibrated in PrepareLogging During ARM
+
+  // Timestamp Start of 1st Block for Gap Accounting and Latency Report
+  SDWriteBlockTime = AcquisitionStartTime = micros();
+  ADCLogging = true;
+
+#ifdef USE_SYNC_INPUT
+  // Put Sync Edge Captures on the Block Timebase
+  AlignSync();
+#endif
+
+#ifdef USE_ISR_BENCHMARK
+  // Time Only Interrupts of the Logged Run, Not the ARM Self Test
+  DMAISRTiming = {};
+  DMAISRTiming.low = DMAISRTiming.periodlow = UINT32_MAX;
+#endif
+
+  // Keep Self Test Baselines, Clear Statistics of Any Earlier Run
+  for (QuickLookChannel &channel : QuickLook)
   {
-    ErrorBlink(ERR_HAL_ADC);
+    channel.peak = 0;
+    channel.peaktime = 0;
+    channel.area = channel.above = 0;
   }
+  QuickLookBlocks = QuickLookSpan = 0;
 
   // Enable ADC and Trigger Conversion
   // Account for 2 Byte Size of Each ADC Sample
-  HAL_ADC_Start_DMA(
+  TraceHAL(__LINE__, HAL_ADC_Start_DMA(
     &hadc1,
     (uint32_t *)DMABuffer,
     sizeof(DMABuffer) / sizeof(uint16_t)
+  ));
+
+  // Mark Start of Acquisition
+  PostEvent(EVENT_LOG_START);
+
+#ifdef USE_SLOW_CHANNELS
+  // Arm Injected Group and Start its Trigger Timer
+  HAL_ADCEx_InjectedStart_IT(&hadc1);
+  HAL_TIM_Base_Start(&htim15);
+#endif
+}
+
+
+// Timestamp Igniter Assertion for Launch Latency Report
+uint32_t MarkIgnition()
+{
+  IgnitionTime = micros();
+  return IgnitionTime - LastCommandTime();
+}
+
+
+// Write Record Header to Binary Logfile
+// See LogFormat.hpp for Record Layout
+void WriteRecordHeader(File &LogFile, uint16_t Type, uint16_t Length)
+{
+  LogRecordHeader header = {Type, Length};
+  LogFile.write((const uint8_t *)&header, sizeof(LogRecordHeader));
+}
+
+
+// Write All Pending Events to Binary Logfile as One Record
+void WriteEventRecords(File &LogFile)
+{
+  // Queue Length Plus One for a Possible Overflow Report
+  LogEventRecord events[EVENT_QUEUE_LEN + 1];
+  uint16_t count = 0;
+
+  while (count < EVENT_QUEUE_LEN + 1 && PopEvent(events[count]))
+  {
+    count++;
+  }
+
+  // Nothing to Write
+  if (count == 0)
+  {
+    return;
+  }
+
+  WriteRecordHeader(LogFile, LOG_RECORD_EVENT, count * sizeof(LogEventRecord));
+  LogFile.write((const uint8_t *)events, count * sizeof(LogEventRecord));
+}
+
+
+// Write Closed Acquisition Gap to Binary Logfile
+// Returns Time at which Acquisition Resumed
+uint32_t WriteGapRecord(File &LogFile)
+{
+  // Copy Gap with Interrupts Masked
+  // A Fault Handler may Reopen the Gap Otherwise
+  noInterrupts();
+  LogGapRecord gap = PendingGap;
+  GapReady = GapOpen = false;
+  interrupts();
+
+  LostScans += gap.lostscans;
+
+  WriteRecordHeader(LogFile, LOG_RECORD_GAP, sizeof(LogGapRecord));
+  LogFile.write((const uint8_t *)&gap, sizeof(LogGapRecord));
+
+  return gap.resume;
+}
+
+
+#ifdef USE_SYNC_INPUT
+// Write All Pending Sync Pulse Edges to Binary Logfile as One Record
+void WriteSyncRecords(File &LogFile)
+{
+  LogSyncRecord edges[SYNC_QUEUE_LEN];
+  uint16_t count = 0;
+
+  while (count < SYNC_QUEUE_LEN && PopSync(edges[count]))
+  {
+    count++;
+  }
+
+  // Nothing to Write
+  if (count == 0)
+  {
+    return;
+  }
+
+  WriteRecordHeader(LogFile, LOG_RECORD_SYNC, count * sizeof(LogSyncRecord));
+  LogFile.write((const uint8_t *)edges, count * sizeof(LogSyncRecord));
+}
+#endif
+
+
+// Report Acquisition Faults After Logging Stops
+void ReportLoggingFaults()
+{
+  PostStatus(STATUS_LOGGING_FAULTS, {ADCOverruns, DMAErrors, LostScans});
+}
+
+
+// Report Latency from Igniter Assertion to Sampling and Storage
+void ReportLaunchLatency()
+{
+  // Acquisition is Triggered Before the Igniters Fire
+  uint32_t lead = IgnitionTime - AcquisitionStartTime;
+
+  // Regular Scans Complete Once per Scan Period from Acquisition Start
+  // Time Remaining to the 1st Scan Completed After Ignition
+  uint32_t period = ADC_SCAN_PERIOD_NS;
+  uint32_t sample = period - ((uint64_t)lead * 1000UL) % period;
+
+  PostStatus(
+    STATUS_LAUNCH_LATENCY,
+    {sample, lead, FirstBlockStoredTime - IgnitionTime}
   );
+
+  // Compared Across Boards Launched Together for their Trigger Skew
+  PostStatus(STATUS_LAUNCH_TRIGGER, {IgnitionTime - LastCommandTime()});
 }
 
 
-// Log Finalised Binary DMA Buffers to SD Card
-void LogBuffersinLoop()
+// Accumulate Quick-Look Statistics of One Regular Block
+// Scans Share the Block Span Evenly, as in InterpolateTimes in ConvertLog.py
+void UpdateQuickLook(const uint16_t *Block, uint32_t Start, uint32_t End)
 {
-  // Create Binary Logfile on SD Card
-  File LogFile = SD.open(GetLogfileName(), FILE_WRITE);
+  const uint32_t scans = ADC_DMA_BLOCKLEN / ADC_PARALLEL_CHANNELS;
+  uint32_t span = End - Start;
+
+  ADCLoggedChannels::ForEach([&](uint8_t position, uint8_t input) {
+    QuickLookChannel &channel = QuickLook[position];
+    uint32_t area = 0;
+    uint32_t above = 0;
+    uint16_t peak = 0;
+    uint32_t at = 0;
+
+    for (uint32_t scan = 0; scan < scans; scan++)
+    {
+      uint16_t sample = Block[scan * ADC_PARALLEL_CHANNELS + position];
+
+      if (sample > peak)
+      {
+        peak = sample;
+        at = scan;
+      }
+
+      // Area Above Baseline of Samples Past the Threshold
+      if (sample >= channel.threshold)
+      {
+        area += sample - channel.baseline;
+        above++;
+      }
+    }
+
+    if (peak > channel.peak)
+    {
+      channel.peak = peak;
+      channel.peaktime = Start + ((uint64_t)span * at) / scans;
+    }
+
+    // Scan Counts to Microseconds Once per Block
+    channel.area += ((uint64_t)area * span) / scans;
+    channel.above += ((uint64_t)above * span) / scans;
+  });
+
+  QuickLookBlocks++;
+  QuickLookSpan += span;
+}
+
+
+// Report Quick-Look Burn Summary Without Rereading the Binary Logfile
+// Times are Milliseconds from Igniter Assertion, Impulse is in Count Milliseconds
+void ReportQuickLook()
+{
+  PostStatus(STATUS_QUICKLOOK_BLOCKS, {QuickLookBlocks, QuickLookSpan / 1000U});
+  if (!QuickLookBlocks)
+  {
+    return;
+  }
+
+  ADCLoggedChannels::ForEach([&](uint8_t position, uint8_t input) {
+    QuickLookChannel &channel = QuickLook[position];
+    int32_t peaktime = (int32_t)(channel.peaktime - IgnitionTime) / 1000L;
+
+    PostStatus(
+      STATUS_QUICKLOOK,
+      {
+        input, channel.baseline, channel.peak, ZigZag(peaktime),
+        (uint32_t)(channel.area / 1000UL), (uint32_t)(channel.above / 1000UL)
+      }
+    );
+  });
+}
+
+
+#ifdef USE_ISR_BENCHMARK
+// Report DMA Interrupt Cycles and Entry Spacing Jitter of the Logged Run
+// Build with and without USE_LL_DMA_IRQ to Compare Backends
+void ReportISRLatency()
+{
+  uint32_t calls = DMAISRTiming.calls;
+  if (!calls)
+  {
+    return;
+  }
+
+  // Mean and Standard Deviation in Hundredths of a Cycle
+  uint32_t mean = (DMAISRTiming.sum * 100UL) / calls;
+  uint64_t spread = (uint64_t)calls * DMAISRTiming.squares - DMAISRTiming.sum * DMAISRTiming.sum;
+  uint32_t deviation = SquareRoot(spread * 10000UL) / calls;
+
+  // Spread of Entry to Entry Spacing, Zero Without Two Consecutive Blocks
+  uint32_t jitter = (DMAISRTiming.periodhigh >= DMAISRTiming.periodlow)
+    ? DMAISRTiming.periodhigh - DMAISRTiming.periodlow : 0;
+
+#ifdef USE_LL_DMA_IRQ
+  const char *backend = "LL";
+#else
+  const char *backend = "HAL";
+#endif
+
+  PostStatus(
+    STATUS_ISR_LATENCY,
+    {calls, DMAISRTiming.low, mean, DMAISRTiming.high, deviation, jitter},
+    backend
+  );
+}
+#endif
+
+
+// Write Configuration Record at Start of Binary Logfile
+void WriteConfigRecord(File &LogFile)
+{
+  LogConfigRecord config = {};
+
+  // Describe Block Layouts and Rates
+  config.version = LOG_FORMAT_VERSION;
+  config.fastchannels = ADC_PARALLEL_CHANNELS;
+  config.slowchannels = ADC_SLOW_CHANNELS;
+  config.samplebits = ADC_SAMPLE_BITS;
+  config.fastblocklen = ADC_DMA_BLOCKLEN;
+  config.slowblockscans = ADC_SLOW_BLOCKSCANS;
+  config.slowperiod = ADC_SLOW_PERIOD_US;
+
+  // Describe Channel Maps in Scan Order
+  ADCLoggedChannels::ForEach([&](uint8_t position, uint8_t input) {
+    config.fastinputs[position] = input;
+  });
+  ADCSlowChannels::ForEach([&](uint8_t position, uint8_t input) {
+    config.slowinputs[position] = input;
+  });
+
+  WriteRecordHeader(LogFile, LOG_RECORD_CONFIG, sizeof(LogConfigRecord));
+  LogFile.write((const uint8_t *)&config, sizeof(LogConfigRecord));
+}
+
+
+// Create Binary Logfile Segment and Write its Leading Records
+File OpenLogSegment(uint16_t Segment, uint32_t Previous)
+{
+  // Create Binary Logfile Segment on SD Card
+  File LogFile = SD.open(GetSegmentName(GetLogfileName(), Segment), FILE_WRITE);
 
   // Abort if File is not Open
   if (!LogFile) {
     ErrorBlink(ERR_SD_FILE);
   }
 
+  // Describe Logfile Layout for Converters
+  WriteConfigRecord(LogFile);
+
+  // Link Segment to End of Previous Segment
+  LogSegmentRecord record = {Segment, 0, Previous};
+  WriteRecordHeader(LogFile, LOG_RECORD_SEGMENT, sizeof(LogSegmentRecord));
+  LogFile.write((const uint8_t *)&record, sizeof(LogSegmentRecord));
+
+  return LogFile;
+}
+
+
+// Calibrate ADC and Open Binary Log File Ahead of LAUNCH
+// Keeps Slow Setup Work Out of the Path from LAUNCH to 1st Stored Block
+void PrepareLogging()
+{
+  // Calibrate ADC in Single Ended Input Mode Before Triggering
+  // ADC is Disabled After Configuration, as Calibration Requires
+  // The Calibration Factor is Kept Until the ADC is Powered Down
+  // See Errata 2.6.10 in ST's ES0456 Errata Document for L412KBU6U
+  if (TraceHAL(__LINE__, HAL_ADCEx_Calibration_Start(&hadc1, ADC_SINGLE_ENDED)) != HAL_OK)
+  {
+    ErrorBlink(ERR_HAL_ADC);
+  }
+
+  PostStatus(
+    STATUS_ADC_CALIBRATION,
+    {HAL_ADCEx_Calibration_GetValue(&hadc1, ADC_SINGLE_ENDED)}
+  );
+
+  // Create 1st Binary Logfile Segment and Commit its Directory Entry
+  // The 1st Block Write Then Only Appends Data
+  SDLogCreated = !SD.exists(GetLogfileName());
+  SDLogFile = OpenLogSegment(0, 0);
+  SDLogFile.flush();
+}
+
+
+// Recalibrate Idle ADC While ARMed
+// The Calibration Factor Drifts as the Board Warms Up Before LAUNCH
+// ADC is Disabled Between Self Test and LAUNCH, as Calibration Requires
+void RefreshCalibration()
+{
+  uint32_t previous = HAL_ADCEx_Calibration_GetValue(&hadc1, ADC_SINGLE_ENDED);
+
+  if (TraceHAL(__LINE__, HAL_ADCEx_Calibration_Start(&hadc1, ADC_SINGLE_ENDED)) != HAL_OK)
+  {
+    ErrorBlink(ERR_HAL_ADC);
+  }
+
+  // Report Only Changed Calibration Factors
+  uint32_t current = HAL_ADCEx_Calibration_GetValue(&hadc1, ADC_SINGLE_ENDED);
+  if (current != previous)
+  {
+    PostStatus(STATUS_ADC_CALIBRATION, {current});
+  }
+}
+
+
+// Close and Delete Prepared Binary Log File if LAUNCH is Aborted
+void AbortLogging()
+{
+  if (!SDLogFile)
+  {
+    return;
+  }
+
+  SDLogFile.close();
+
+  // Remove Only a File this ARM Created, Never a Completed Run
+  if (SDLogCreated)
+  {
+    SD.remove(GetLogfileName(false));
+  }
+  SDLogCreated = false;
+
+  // Next ARM Selects its Own Log File Name
+  ReleaseLogfileName();
+}
+
+
+// Write Timestamped Injected Scans as One Slow Record
+// Blocks are Full While Logging, Only the Last may be Partial
+void WriteSlowRecord(File &LogFile, const SlowScan *Scans, uint16_t Count)
+{
+  WriteRecordHeader(LogFile, LOG_RECORD_SLOW, Count * sizeof(SlowScan));
+  LogFile.write((const uint8_t *)Scans, Count * sizeof(SlowScan));
+}
+
+
+// Log Finalised Binary DMA Buffers to SD Card
+void LogBuffersinLoop()
+{
+  // Track Segment and Last Regular Block for Logfile Rotation
+  uint16_t segment = 0;
+  uint32_t previous = 0;
+
+  // Write to 1st Binary Logfile Segment Prepared in ARM
+  File &LogFile = SDLogFile;
+
+  // Time Only the 1st Regular Block for Launch Latency Report
+  bool first = true;
+
   // Start Logging Loop
-  // Stop Loop on Receipt of Newline Character
+  // Stop Loop on Receipt of a GroundSide Command
+  bool stop = false;
   do {
     // Check if DMA Handler Aborted
     if (SDWriteError)
     {
+      // Keep Events Leading Up to the Error
+      WriteEventRecords(LogFile);
+
       // Close File on SD Card After Logging Loop
       LogFile.close();
 
@@ -451,21 +1439,147 @@ void LogBuffersinLoop()
       // Set SD Card Write Flag
       SDWriting = true;
 
+      // Latch Block Completion Timestamp Before Next Callback
+      uint32_t time = SDWriteBlockTime;
+      uint32_t start = micros();
+
       // Dump Block to SD Card
       // NOTE: Each ADC Sample in Block is 2 Bytes
+      WriteRecordHeader(
+        LogFile,
+        LOG_RECORD_FAST,
+        ADC_DMA_BLOCKLEN * sizeof(uint16_t) + sizeof(uint32_t)
+      );
       LogFile.write(
         (const uint8_t *)SDWriteBlockStart,
         ADC_DMA_BLOCKLEN * sizeof(uint16_t)
       );
 
       // Write Timestamp to SD Card
-      uint32_t time = micros();
       LogFile.write((const uint8_t *)&time, sizeof(uint32_t));
 
+      // The 1st Block Starts with Acquisition, Later Blocks with their Predecessor
+      uint32_t last = previous ? previous : AcquisitionStartTime;
+      previous = time;
+
+      // Mark 1st Block Reaching the SD Card
+      if (first)
+      {
+        FirstBlockStoredTime = micros();
+        PostEvent(EVENT_FIRST_BLOCK, FirstBlockStoredTime - IgnitionTime);
+        first = false;
+      }
+
+      // Latch Write Time Before the Quick-Look Update
+      uint32_t written = micros() - start;
+
+      // Update Quick-Look Statistics While the Write Flag Still Guards the Block
+      // Overrunning the Block Period Raises an SD Buffer Error as a Slow Write Does
+      UpdateQuickLook(SDWriteBlockStart, last, time);
+
       // Reset SD Card Write Flag
       SDWriting = false;
+
+      // Record Write Time and DMA Buffer Fill for Post-Mortem Dumps
+      // Remaining Transfer Count Shows the Margin Left Before the Next Block
+      Trace(
+        TRACE_BLOCK_WRITE, 0,
+        (uint16_t)(2 * ADC_DMA_BLOCKLEN - __HAL_DMA_GET_COUNTER(&hdma_adc1)),
+        written
+      );
+
+      // Warn if Next Block was Finalised During this Write
+      // Less than One Block of Margin Remains Before an SD Buffer Error
+      if (SDWriteBlockReady)
+      {
+        PostEvent(EVENT_SD_HIGHWATER, micros() - start);
+      }
+
+#ifdef USE_LOG_SEGMENTS
+      // Switch to Next Segment Right After a Block Write
+      // Leaves Almost a Full Block Period for the Switch
+      if (LogFile.size() >= LOG_SEGMENT_BYTES)
+      {
+        LogFile.close();
+        LogFile = OpenLogSegment(++segment, previous);
+      }
+#endif
+    }
+
+    // Check if Injected Scan Block is Ready For Write
+    if (SlowWriteBlockReady)
+    {
+      // Dump Block of Timestamped Scans to SD Card
+      WriteSlowRecord(LogFile, SlowWriteBlockStart, ADC_SLOW_BLOCKSCANS);
+
+      // Reset Injected Block Write Status
+      SlowWriteBlockReady = false;
     }
-  } while (RYLR.read() != '\n');
+
+    // Restart Acquisition Deferred by Fault Handler
+    // Block Write Above has Released the 1st Block
+    if (ADCRestartPending && !SDWriteBlockReady)
+    {
+      RestartAcquisition();
+    }
+
+    // Write Closed Acquisition Gap
+    if (GapReady)
+    {
+      uint32_t resume = WriteGapRecord(LogFile);
+
+      // Following Block Starts at Resume Time
+      if (previous)
+      {
+        previous = resume;
+      }
+    }
+
+    // Interleave Pending Event Markers
+    WriteEventRecords(LogFile);
+
+#ifdef USE_SYNC_INPUT
+#ifdef USE_SYNC_SIMULATOR
+    SimulateSync();
+#endif
+
+    // Interleave Captured Sync Pulse Edges
+    WriteSyncRecords(LogFile);
+#endif
+
+    // Stop on Any New GroundSide Command
+    // Retried Commands are Acknowledged and Ignored, See Radio.hpp
+    if (RYLR.available())
+    {
+      String command;
+      ParseRYLR(command);
+      stop = (command != "\n");
+    }
+  } while (!stop);
+
+  // Mark Receipt of Stop Command
+  PostEvent(EVENT_LOG_STOP);
+
+#ifdef USE_SLOW_CHANNELS
+  // Stop Injected Scan Triggers and Conversions
+  HAL_TIM_Base_Stop(&htim15);
+  TraceHAL(__LINE__, HAL_ADCEx_InjectedStop_IT(&hadc1));
+
+  // Keep Completed and Partially Filled Injected Blocks
+  if (SlowWriteBlockReady)
+  {
+    WriteSlowRecord(LogFile, SlowWriteBlockStart, ADC_SLOW_BLOCKSCANS);
+    SlowWriteBlockReady = false;
+  }
+
+  uint16_t partial = (SlowScanIndex >= ADC_SLOW_BLOCKSCANS) ? ADC_SLOW_BLOCKSCANS : 0;
+  if (SlowScanIndex > partial)
+  {
+    WriteSlowRecord(LogFile, &SlowBuffer[partial], SlowScanIndex - partial);
+  }
+#endif
+
+  WriteEventRecords(LogFile);
 
   // Close File on SD Card After Logging Loop
   LogFile.close();
@@ -473,23 +1587,154 @@ void LogBuffersinLoop()
   // Finish Signal was Received from RYLR
   // Signal Stop of Data Logging on SD Card for ADC Callbacks
   SDLogStop = true;
+  ADCLogging = false;
 
   // Clear Circular DMA Buffer
   memset(DMABuffer, 0X00, sizeof(DMABuffer));
 }
 
 
+// Check Configuration Record at Start of Binary Logfile
+// Converter Loops are Unrolled at Compile Time for this Build's Channel Maps
+bool ReadConfigRecord(File &LogFile)
+{
+  LogRecordHeader header;
+  LogConfigRecord config;
+
+  // Read and Check Record Header
+  if (LogFile.read(&header, sizeof(LogRecordHeader)) != sizeof(LogRecordHeader) ||
+      header.type != LOG_RECORD_CONFIG ||
+      header.length != sizeof(LogConfigRecord))
+  {
+    return false;
+  }
+
+  // Read and Check Block Layouts
+  if (LogFile.read(&config, sizeof(LogConfigRecord)) != sizeof(LogConfigRecord) ||
+      config.version != LOG_FORMAT_VERSION ||
+      config.fastchannels != ADC_PARALLEL_CHANNELS ||
+      config.slowchannels != ADC_SLOW_CHANNELS ||
+      config.fastblocklen != ADC_DMA_BLOCKLEN)
+  {
+    return false;
+  }
+
+  // Check Channel Maps Match in Scan Order
+  bool match = true;
+  ADCLoggedChannels::ForEach([&](uint8_t position, uint8_t input) {
+    match &= (config.fastinputs[position] == input);
+  });
+  ADCSlowChannels::ForEach([&](uint8_t position, uint8_t input) {
+    match &= (config.slowinputs[position] == input);
+  });
+
+  return match;
+}
+
+
+// Open Event CSV File Once, on the First Marker of a Log
+// Earlier Segments may Already have Created It, so the Header is Written Once
+void OpenEventFile(File &EventFile, const String &Path)
+{
+  if (!EventFile)
+  {
+    EventFile = SD.open(Path, FILE_WRITE);
+    if (EventFile.size() == 0)
+    {
+      EventFile.println("Time (us), Cycles, Event, Value");
+    }
+  }
+}
+
+
+// Append Blank CSV Columns for Every Channel of a Channel Map
+template <typename Channels>
+void AppendBlankColumns(Message &Buffer)
+{
+  Channels::ForEach([&](uint8_t position, uint8_t input) {
+    Buffer += ", ";
+  });
+}
+
+
+// Read Ahead Handle for Slow Scans in ConvertLog
+// Slow Records are Written After their Whole Block of Scans Completes,
+// so Slow Scans are Read Ahead of the Fast Rows Converted Before Them
+struct SlowScanReader {
+  File file;
+  uint16_t next;
+  uint16_t count;
+  bool done;
+};
+
+
+// Load Record Holding the Next Slow Scan into Injected Scan Buffer
+// Returns False Once No Slow Scans Remain
+bool NextSlowScan(SlowScanReader &Reader)
+{
+  LogRecordHeader header;
+
+  while (Reader.next >= Reader.count && !Reader.done)
+  {
+    if (Reader.file.read(&header, sizeof(LogRecordHeader)) != sizeof(LogRecordHeader))
+    {
+      Reader.done = true;
+    } else if (header.type == LOG_RECORD_SLOW && header.length <= sizeof(SlowBuffer)) {
+      Reader.file.read(SlowBuffer, header.length);
+      Reader.next = 0;
+      Reader.count = header.length / sizeof(SlowScan);
+    } else {
+      // Skip Records of Other Types
+      Reader.file.seek(Reader.file.position() + header.length);
+    }
+  }
+
+  return Reader.next < Reader.count;
+}
+
+
+// Write Slow Scan Rows Timed Before Limit
+// Fast Rows Go Before Slow Rows with the Same Time, as in ConvertLog.py
+void WriteSlowRows(File &CSVFile, SlowScanReader &Reader, Message &Buffer, uint64_t Limit)
+{
+  while (ADC_SLOW_CHANNELS && NextSlowScan(Reader) && SlowBuffer[Reader.next].time < Limit)
+  {
+    // Clear Line Buffer and Append Scan Timestamp
+    // Slow Scans Share the Microsecond Timebase of Fast Blocks
+    SlowScan &scan = SlowBuffer[Reader.next++];
+    Buffer = ' ';
+    Buffer += scan.time;
+
+    // Leave Fast Channel Columns Blank
+    AppendBlankColumns<ADCLoggedChannels>(Buffer);
+
+    // Append Slow Channel Sample Data to Buffer
+    ADCSlowChannels::ForEach([&](uint8_t position, uint8_t input) {
+      Buffer += ", ";
+      Buffer += scan.samples[position];
+    });
+
+    // Write Buffer to CSV File
+    CSVFile.println(Buffer);
+  }
+}
+
+
 // Binary Logfile to CSV File Converter
 void ConvertLog(const String &Path)
 {
   // Containers for Files and Associated Data
-  File CSVFile, LogFile;
-  String CSVFileName, buffer;
+  File CSVFile, LogFile, EventFile;
+  String CSVFileName, EventFileName;
+  Message buffer;
+  LogRecordHeader header;
+  LogEventRecord event;
+  LogSyncRecord sync;
+  LogGapRecord gap;
+  LogSegmentRecord segment;
+  SlowScanReader slow = {};
   uint32_t StartTime, EndTime, progress;
 
-  // Reserve Line Buffer Length
-  buffer.reserve(64UL);
-
   // Clear DMA Buffer for Conversion Purposes
   memset(DMABuffer, 0X00, sizeof(DMABuffer));
 
@@ -503,8 +1748,8 @@ void ConvertLog(const String &Path)
     return;
   } else {
     // Output Logfile Diagnostics
-    SendRYLR("FILENAME: " + String(LogFile.name()));
-    SendRYLR("FILESIZE: " + String(LogFile.size()));
+    PostStatus(STATUS_FILENAME, {}, LogFile.name());
+    PostStatus(STATUS_FILESIZE, {LogFile.size()});
   }
 
   // Copy Logfile Name for CSV File
@@ -512,6 +1757,14 @@ void ConvertLog(const String &Path)
 
   // Change File Extension to .csv
   CSVFileName.remove(CSVFileName.lastIndexOf('.'));
+
+  // Events of All Segments of Run N are Exported to N_EV.csv
+  EventFileName = CSVFileName;
+  if (EventFileName.indexOf('_') >= 0)
+  {
+    EventFileName.remove(EventFileName.indexOf('_'));
+  }
+  EventFileName += "_EV.csv";
   CSVFileName += ".csv";
 
   // Attempt to Open CSV File
@@ -525,67 +1778,173 @@ void ConvertLog(const String &Path)
     return;
   }
 
-  // Reset Line Buffer and Prepare CSV Header
-  // NOTE: See Interfaces.hpp
-  buffer = "Time (us)";
-  for (short channel = 0; channel < ADC_PARALLEL_CHANNELS; channel++)
+  // Start Reading Logfile
+  LogFile.seek(0UL);
+  StartTime = progress = 0UL;
+
+  // Check Logfile Starts with a Configuration Record
+  // Abort if Logfile Layout does not Match this Build
+  if (!ReadConfigRecord(LogFile))
+  {
+    PostStatus(STATUS_CONFIG_MISMATCH);
+
+    // Close all Files and Abort
+    LogFile.close();
+    CSVFile.close();
+    return;
+  }
+
+  // Open 2nd Read Only Handle to Merge Slow Scans by Time
+  // Positioned After the Configuration Record, Like the Logfile
+  if (ADC_SLOW_CHANNELS)
   {
-    buffer += ", A";
-    buffer += channel;
+    slow.file = SD.open(Path, FILE_READ);
+    if (!slow.file)
+    {
+      ErrorBlink(ERR_SD_FILE);
+      return;
+    }
+    slow.file.seek(LogFile.position());
   }
 
   // Write Header at Start of CSV file
+  // NOTE: Header is Generated from Channel Maps, See Interfaces.hpp
   CSVFile.seek(0UL);
-  CSVFile.println(buffer);
-
-  // Start Reading Logfile
-  LogFile.seek(0UL);
-  StartTime = progress = 0UL;
+  CSVFile.print("Time (us)");
+  CSVFile.print(ADCLoggedChannels::labels.text);
+  CSVFile.println(ADCSlowChannels::labels.text);
 
-  // Iterate Through All Logged DMA Buffer Blocks
-  do
+  // Iterate Through All Logged Records
+  while (LogFile.read(&header, sizeof(LogRecordHeader)) == sizeof(LogRecordHeader))
   {
-    // Read Data from Logfile into 1st Block of Circular Buffer
-    // Account for 2 Byte Width of Each ADC Sample
-    LogFile.read(DMABuffer, ADC_DMA_BLOCKLEN * sizeof(uint16_t));
+    if (header.type == LOG_RECORD_FAST)
+    {
+      // Read Data from Logfile into 1st Block of Circular Buffer
+      // Account for 2 Byte Width of Each ADC Sample
+      LogFile.read(DMABuffer, ADC_DMA_BLOCKLEN * sizeof(uint16_t));
 
-    // Read Timestamp from Logfile
-    LogFile.read(&EndTime, sizeof(uint32_t));
+      // Read Timestamp from Logfile
+      LogFile.read(&EndTime, sizeof(uint32_t));
 
-    // Load Starting Timestamp if Blank
-    if (!StartTime)
-    {
+      // Load Starting Timestamp if Blank
+      if (!StartTime)
+      {
+        StartTime = EndTime;
+
+        // Discard First Buffer's Data
+        continue;
+      }
+
+      // Process Each ADC Sample in DMA buffer in Rows
+      for (uint16_t index = 0; index < ADC_DMA_BLOCKLEN; index += ADC_PARALLEL_CHANNELS)
+      {
+        // Calculate Timestamp for Current Row of Samples
+        // 64-Bit Product, Slow Scan Timings Give Blocks Spanning Seconds
+        uint32_t time = (((uint64_t)(EndTime - StartTime) * index) / ADC_DMA_BLOCKLEN) + StartTime;
+
+        // Write Slow Scans Taken Before this Row
+        WriteSlowRows(CSVFile, slow, buffer, time);
+
+        // Clear Line Buffer and Append Timestamp
+        buffer = ' ';
+        buffer += time;
+
+        // Deinterleave and Append ADC Sample Data to Buffer
+        // Loop is Unrolled over Channel Map, See Interfaces.hpp
+        ADCLoggedChannels::ForEach([&](uint8_t position, uint8_t input) {
+          buffer += ", ";
+          buffer += DMABuffer[index + position];
+        });
+
+        // Leave Slow Channel Columns Blank
+        AppendBlankColumns<ADCSlowChannels>(buffer);
+
+        // Write Buffer to CSV File
+        CSVFile.println(buffer);
+      }
+
+      // Update Timestamp for Next Block
       StartTime = EndTime;
+    } else if (header.type == LOG_RECORD_SEGMENT && header.length == sizeof(LogSegmentRecord)) {
+      LogFile.read(&segment, sizeof(LogSegmentRecord));
 
-      // Discard First Buffer's Data
-      continue;
-    }
+      // Continue Timestamps from the Previous Segment
+      if (segment.previous)
+      {
+        StartTime = segment.previous;
+      }
+    } else if (header.type == LOG_RECORD_GAP && header.length == sizeof(LogGapRecord)) {
+      LogFile.read(&gap, sizeof(LogGapRecord));
 
-    // Process Each ADC Sample in DMA buffer in Rows
-    for (uint16_t index = 0; index < ADC_DMA_BLOCKLEN; index += ADC_PARALLEL_CHANNELS)
-    {
-      // Clear Line Buffer
+      // Write Slow Scans Taken Before the Gap
+      WriteSlowRows(CSVFile, slow, buffer, gap.start);
+
+      // Mark Missing Data with a Blank Row at Start of Gap
       buffer = ' ';
+      buffer += gap.start;
+      AppendBlankColumns<ADCLoggedChannels>(buffer);
+      AppendBlankColumns<ADCSlowChannels>(buffer);
+      CSVFile.println(buffer);
 
-      // Calculate Timestamp for Current Row of Samples
-      buffer += (uint32_t)(
-        (((EndTime - StartTime) * index) / ADC_DMA_BLOCKLEN) + StartTime
-      );
+      // Next Block Starts at Restart Time, Not at End of Previous Block
+      // A Gap Before the 1st Block Leaves it Discarded as Usual
+      if (StartTime)
+      {
+        StartTime = gap.resume;
+      }
 
-      // Deinterleave and Append ADC Sample Data to Buffer
-      // NOTE: See Interfaces.hpp
-      for (short channel = 0; channel < ADC_PARALLEL_CHANNELS; channel++)
+      // Create Event CSV File on First Marker
+      OpenEventFile(EventFile, EventFileName);
+
+      // Export Gap with Number of Lost Scans
+      buffer = ' ';
+      buffer += gap.start;
+      buffer += ", 0, GAP, ";
+      buffer += gap.lostscans;
+      EventFile.println(buffer);
+    } else if (header.type == LOG_RECORD_EVENT) {
+      // Create Event CSV File on First Marker
+      OpenEventFile(EventFile, EventFileName);
+
+      // Process Each Event Marker in Rows
+      // Event Times Share the Microsecond Timebase of Sample Rows
+      for (uint16_t entry = 0; entry < header.length / sizeof(LogEventRecord); entry++)
       {
+        LogFile.read(&event, sizeof(LogEventRecord));
+
+        buffer = ' ';
+        buffer += event.time;
+        buffer += ", ";
+        buffer += event.cycles;
         buffer += ", ";
-        buffer += DMABuffer[index + channel];
+        buffer += EventName(event.code);
+        buffer += ", ";
+        buffer += event.value;
+
+        EventFile.println(buffer);
       }
+    } else if (header.type == LOG_RECORD_SYNC) {
+      // Create Event CSV File on First Marker
+      OpenEventFile(EventFile, EventFileName);
 
-      // Write Buffer to CSV File
-      CSVFile.println(buffer);
-    }
+      // Export Each Sync Pulse Edge as an Alignment Point
+      // Value is the Edge Sequence Number, Matching Pulse Counts of the Other DAQs
+      for (uint16_t entry = 0; entry < header.length / sizeof(LogSyncRecord); entry++)
+      {
+        LogFile.read(&sync, sizeof(LogSyncRecord));
+
+        buffer = ' ';
+        buffer += sync.time;
+        buffer += ", 0, SYNC, ";
+        buffer += sync.sequence;
 
-    // Update Timestamp for Next Block
-    StartTime = EndTime;
+        EventFile.println(buffer);
+      }
+    } else {
+      // Skip Unknown Records
+      // Slow Records are Written by the Read Ahead Handle
+      LogFile.seek(LogFile.position() + header.length);
+    }
 
     // Send Progress Update on Significant Progress
     // Updates Sent to GroundSide Every 128 KB of Processed Data
@@ -593,19 +1952,18 @@ void ConvertLog(const String &Path)
     {
       progress = LogFile.position();
 
-      // Build Progress Report
-      buffer = "PROGRESS: ";
-      buffer += progress;
-      buffer += " / ";
-      buffer += LogFile.size();
-      buffer += " BYTES";
-
       // Send Progress Report
-      SendRYLR(buffer);
+      PostStatus(STATUS_PROGRESS, {progress, LogFile.size()});
+      FlushStatus();
     }
-  } while (LogFile.available());
+  }
+
+  // Write Slow Scans Taken After the Last Fast Row
+  WriteSlowRows(CSVFile, slow, buffer, UINT64_MAX);
 
   // Close Binary Log and CSV Files
   LogFile.close();
+  slow.file.close();
   CSVFile.close();
+  EventFile.close();
 }
@@ -7,34 +7,96 @@
 #define HAL_ADC_MODULE_ONLY
 
 
+// #### DMA Interrupt Backend
+// Handle Block Flags in DMA1_Channel1_IRQHandler by Register Access
+// Otherwise HAL_DMA_IRQHandler Dispatches to the HAL ADC Callbacks
+// #define USE_LL_DMA_IRQ
+
+// Time DMA Interrupts with the DWT Cycle Counter During Logging
+// Reported with STATUS_ISR_LATENCY After Logging Stops
+// #define USE_ISR_BENCHMARK
+
+
 // #### DMA Data Logging Functions
 // DMA Module Configuration
 void ConfigureDMA(bool Continuous = false);
 
+// Hand Completed DMA Block to the Logging Loop
+void CompleteBlock(uint16_t *Block);
+
 // Successful Block One DMA Transfer Completion Callback
 void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc);
 
 // Successful Block Two DMA Transfer Completion Callback
 void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc);
 
+// ADC Conversion Error Callback
+void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc);
+
+// Restart ADC DMA Transfer After a Fault
+void RestartAcquisition();
+
 // ADC Module Configuration
 void ConfigureADC(bool Continuous = false);
 
+// Injected Group and Trigger Timer Configuration for Slow Channels
+void ConfigureSlowChannels();
+
 // Readout Analog Pins to Check Input
 void ReadoutAnalogPins();
 
+// Burst Sample Logged Channels through Continuous DMA and Check Inputs
+bool SelfTestAnalogPins();
+
 // Binary Log File Name Helper
 String GetLogfileName(bool Initialise = true);
 
+// Forget the Current Run's Binary Log File Name
+void ReleaseLogfileName();
+
+// Binary Log File Segment Name Helper
+String GetSegmentName(const String &LogName, uint16_t Segment);
+
 // Binary Log File and Initial DMA Buffer Configuration
 void ConfigureLogging();
 
+// Calibrate ADC and Open Binary Log File Ahead of LAUNCH
+void PrepareLogging();
+
+// Recalibrate Idle ADC While ARMed
+void RefreshCalibration();
+
+// Close and Delete Prepared Binary Log File if LAUNCH is Aborted
+void AbortLogging();
+
 // Coupled ADC-DMA Transfer and Logging Trigger
 void TriggerLogging();
 
+// Timestamp Igniter Assertion for Launch Latency Report
+// Returns Trigger Delay from LAUNCH Command Reception (us)
+uint32_t MarkIgnition();
+
 // Log Finalised Binary DMA Buffers to SD Card
 void LogBuffersinLoop();
 
+// Report Acquisition Faults After Logging Stops
+void ReportLoggingFaults();
+
+// Report Latency from Igniter Assertion to Sampling and Storage
+void ReportLaunchLatency();
+
+// Accumulate Quick-Look Statistics of One Regular Block
+// Start and End are the Completion Times of the Previous and this Block (us)
+void UpdateQuickLook(const uint16_t *Block, uint32_t Start, uint32_t End);
+
+// Report Quick-Look Burn Summary of Each Logged Channel After Logging Stops
+void ReportQuickLook();
+
+#ifdef USE_ISR_BENCHMARK
+// Report DMA Interrupt Cycles and Entry Spacing Jitter of the Logged Run
+void ReportISRLatency();
+#endif
+
 // Binary Log File to CSV File Converter
 void ConvertLog(const String &Path);
 
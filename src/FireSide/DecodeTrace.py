@@ -0,0 +1,150 @@
+# Python Script to Decode FireSide Post-Mortem Trace Dumps
+# ErrorBlink Appends the Trace Ring to Trace.trc on the SD Card Before Halting
+
+#### Library Imports
+# Command Line Options
+from argparse import ArgumentParser
+
+# Trace Record Parsing
+from struct import unpack_from, iter_unpack, calcsize
+
+# Decoded Trace Output
+from csv import writer
+from os.path import splitext
+
+# Binary Log Record Framing
+from ConvertLog import ReadRecords, LOG_RECORD_TRACE
+
+
+#### Trace Format
+# See TraceDumpRecord and TraceEntry in LogFormat.hpp
+TRACE_FORMAT_VERSION = 1
+TRACE_HEADER = '<BBHIIII'
+TRACE_ENTRY = '<BBHII'
+
+# Entry Kinds
+# See Trace.hpp
+TRACE_STATE = 1
+TRACE_HAL = 2
+TRACE_ADC_ERROR = 3
+TRACE_BLOCK_WRITE = 4
+TRACE_ERROR = 5
+
+# FSM State Names in States Enum Order
+# See States.hpp
+STATE_NAMES = ['BOOT', 'SAFE', 'ARM', 'LAUNCH', 'LOGGING', 'CONVERT', 'FAILURE']
+
+# ErrorBlink Codes
+# See Interfaces.hpp
+ERROR_NAMES = {
+  1: 'HAL ADC',
+  2: 'HAL DMA',
+  3: 'SD INIT',
+  4: 'SD FILE',
+  5: 'SD BUFFER'
+}
+
+# HAL_StatusTypeDef Values
+HAL_STATUS_NAMES = ['OK', 'ERROR', 'BUSY', 'TIMEOUT']
+
+# HAL ADC Error Code Bits
+ADC_ERROR_BITS = {
+  0x01: 'INTERNAL',
+  0x02: 'OVERRUN',
+  0x04: 'DMA',
+  0x08: 'INJECTED QUEUE OVERFLOW'
+}
+
+# Decoded Trace CSV Columns
+TRACE_FIELDS = ['Dump', 'Time (us)', 'Before Dump (us)', 'Cycles', 'Kind', 'Detail']
+
+
+#### Entry Decoding
+# Describes One Trace Entry
+# Returns (Kind Name, Detail Text)
+def DescribeEntry(Kind, Code, Arg, Value):
+  if Kind == TRACE_STATE:
+    return 'STATE', STATE_NAMES[Code] if Code < len(STATE_NAMES) else str(Code)
+
+  if Kind == TRACE_HAL:
+    Status = HAL_STATUS_NAMES[Code] if Code < len(HAL_STATUS_NAMES) else str(Code)
+    return 'HAL', Status + ' AT DMADAQ.cpp:' + str(Arg)
+
+  if Kind == TRACE_ADC_ERROR:
+    Errors = [Name for Bit, Name in ADC_ERROR_BITS.items() if Value & Bit] or [hex(Value)]
+    Flags = [Name for Bit, Name in ((0x01, 'WRITING'), (0x02, 'BLOCK READY')) if Arg & Bit]
+    return 'ADC ERROR', ' | '.join(Errors) + (' WHILE ' + ', '.join(Flags) if Flags else '')
+
+  if Kind == TRACE_BLOCK_WRITE:
+    return 'BLOCK WRITE', '{} US, {} SAMPLES IN DMA BUFFER'.format(Value, Arg)
+
+  if Kind == TRACE_ERROR:
+    return 'ERROR', ERROR_NAMES.get(Code, str(Code))
+
+  return 'UNKNOWN', '{} {} {}'.format(Code, Arg, Value)
+
+
+# Decodes Every Dump in a Trace File
+# Yields (Dump Header, Rows) with Rows of (Time, Before Dump, Cycles, Kind, Detail)
+def DecodeDumps(TracePath):
+  with open(TracePath, 'rb') as TraceFile:
+    for Type, Payload in ReadRecords(TraceFile):
+      if Type != LOG_RECORD_TRACE:
+        continue
+
+      Version, Error, Count, Recorded, Cycles, Time, Clock = unpack_from(TRACE_HEADER, Payload)
+      if Version != TRACE_FORMAT_VERSION:
+        raise ValueError('Unsupported Trace Dump Version ' + str(Version))
+
+      # Place Entries on the Microsecond Timebase of the Dump
+      # Valid for Entries Less than 53 s Old at 80 MHz Core Clock
+      Entries = Payload[calcsize(TRACE_HEADER):]
+      Rows = []
+      for Kind, Code, Arg, EntryCycles, Value in iter_unpack(TRACE_ENTRY, Entries[:Count * calcsize(TRACE_ENTRY)]):
+        Before = ((Cycles - EntryCycles) & 0xFFFFFFFF) // (Clock // 1000000)
+        Rows.append(((Time - Before) & 0xFFFFFFFF, Before, EntryCycles) + DescribeEntry(Kind, Code, Arg, Value))
+
+      yield {
+        'error': ERROR_NAMES.get(Error, str(Error)),
+        'count': Count,
+        'recorded': Recorded,
+        'time': Time,
+        'clock': Clock
+      }, Rows
+
+
+#### Run Trace Decoder
+if __name__ == '__main__':
+  Parser = ArgumentParser(description='FireSide Post-Mortem Trace Decoder')
+  Parser.add_argument('trace', help='Trace File Copied from the SD Card')
+  Parser.add_argument('--last', action='store_true', help='Decode Only the Most Recent Dump')
+  Options = Parser.parse_args()
+
+  # Display Script Startup
+  print('#########')
+  print('FireSide Post-Mortem Trace Decoder')
+  print('#########')
+  print('')
+
+  Dumps = list(DecodeDumps(Options.trace))
+  if Options.last:
+    Dumps = Dumps[-1:]
+
+  if not Dumps:
+    print('No Trace Dumps Found')
+
+  CSVPath = splitext(Options.trace)[0] + '.csv'
+  with open(CSVPath, 'w', newline='') as CSVFile:
+    TraceWriter = writer(CSVFile, lineterminator='\r\n')
+    TraceWriter.writerow(TRACE_FIELDS)
+
+    for Number, (Header, Rows) in enumerate(Dumps):
+      print('>> Dump {}: {} Error at {} us'.format(Number, Header['error'], Header['time']))
+      print('Entries: {} of {} Recorded Since Boot'.format(Header['count'], Header['recorded']))
+
+      for Time, Before, Cycles, Kind, Detail in Rows:
+        print('{:>12} us  -{:>10} us  {:<12} {}'.format(Time, Before, Kind, Detail))
+        TraceWriter.writerow([Number, Time, -Before, Cycles, Kind, Detail])
+      print('')
+
+  print('Decoded Trace File Location: ' + CSVPath)
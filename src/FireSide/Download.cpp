@@ -0,0 +1,243 @@
+// #### Library Headers
+// Arduino Framework and Data Types
+#include <Arduino.h>
+
+
+// #### Internal Headers
+// Hardware Interface Definitions and Functions
+#include "Interfaces.hpp"
+
+// Download Protocol Definitions and Function Prototypes
+#include "Download.hpp"
+
+
+// #### Internal Definitions
+// CRC-32 Lookup Table Container
+struct CRCTable
+{
+  uint32_t entries[256];
+};
+
+// Build Reflected CRC-32 Lookup Table at Compile Time
+// Polynomial 0X04C11DB7, Reflected to 0XEDB88320
+constexpr CRCTable BuildCRCTable()
+{
+  CRCTable table = {};
+
+  for (uint16_t index = 0; index < 256; index++)
+  {
+    uint32_t crc = index;
+    for (uint8_t bit = 0; bit < 8; bit++)
+    {
+      crc = (crc & 1UL) ? (crc >> 1) ^ 0XEDB88320UL : (crc >> 1);
+    }
+    table.entries[index] = crc;
+  }
+
+  return table;
+}
+
+// CRC-32 Lookup Table Stored in Flash
+constexpr CRCTable DownloadCRCTable = BuildCRCTable();
+
+// Frame Payload Buffer
+uint8_t DownloadChunk[DOWNLOAD_CHUNK_LEN];
+
+
+// #### Download Functions
+// Start Download Serial Link
+void ConfigureDownload()
+{
+#ifndef USE_USB_SERIAL
+  // RYLR Uses Pins D0 & D1, USB Serial is Free for Downloads
+  DOWNLOAD_SERIAL.begin(DOWNLOAD_UART_BAUD);
+#endif
+  // Otherwise Serial is Started with RYLR in BootCheck
+}
+
+
+// Check for a Pending Host Download Request
+bool DownloadRequested()
+{
+  return DOWNLOAD_SERIAL.available() &&
+         DOWNLOAD_SERIAL.peek() == DOWNLOAD_REQUEST_START;
+}
+
+
+// CRC-32 of a Data Block
+uint32_t DownloadCRC(const uint8_t *Data, uint16_t Length)
+{
+  uint32_t crc = 0XFFFFFFFFUL;
+
+  for (uint16_t index = 0; index < Length; index++)
+  {
+    crc = DownloadCRCTable.entries[(crc ^ Data[index]) & 0XFFU] ^ (crc >> 8);
+  }
+
+  return ~crc;
+}
+
+
+// Read Chunk at Offset from File and Send it as a Frame
+// Returns Number of Payload Bytes Sent
+uint16_t SendDownloadChunk(File &LogFile, uint32_t Offset)
+{
+  // Load Chunk from SD Card
+  LogFile.seek(Offset);
+  int length = LogFile.read(DownloadChunk, DOWNLOAD_CHUNK_LEN);
+  if (length < 0)
+  {
+    length = 0;
+  }
+
+  // Frame Chunk with Offset and Checksum
+  DownloadChunkHeader header = {
+    DOWNLOAD_FRAME_MAGIC,
+    uint16_t(length),
+    Offset,
+    DownloadCRC(DownloadChunk, length)
+  };
+
+  DOWNLOAD_SERIAL.write((const uint8_t *)&header, sizeof(DownloadChunkHeader));
+  DOWNLOAD_SERIAL.write(DownloadChunk, length);
+
+  return length;
+}
+
+
+// Serve One Host Download Request
+void ServeDownload()
+{
+  // Parse Request Line: DOWNLOAD <File> <Offset>
+  String request = DOWNLOAD_SERIAL.readStringUntil('\n');
+  request.trim();
+
+  if (!request.startsWith("DOWNLOAD "))
+  {
+    DOWNLOAD_SERIAL.print("ERR BAD REQUEST\n");
+    return;
+  }
+
+  request.remove(0, 9);
+  request.trim();
+
+  // Split File Name and Resume Offset
+  String FileName = request;
+  uint32_t offset = 0;
+  if (request.indexOf(' ') > 0)
+  {
+    FileName = request.substring(0, request.indexOf(' '));
+    offset = strtoul(request.substring(request.indexOf(' ') + 1).c_str(), nullptr, 10);
+  }
+
+  // Only Serve Files in the SD Card Root Directory
+  if (FileName.length() == 0 || FileName.indexOf('/') >= 0 || !SD.exists(FileName))
+  {
+    DOWNLOAD_SERIAL.print("ERR NO FILE\n");
+    return;
+  }
+
+  File LogFile = SD.open(FileName, FILE_READ);
+  if (!LogFile)
+  {
+    DOWNLOAD_SERIAL.print("ERR NO FILE\n");
+    return;
+  }
+
+  uint32_t size = LogFile.size();
+  if (offset > size)
+  {
+    LogFile.close();
+    DOWNLOAD_SERIAL.print("ERR BAD OFFSET\n");
+    return;
+  }
+
+  // Accept Request
+  DOWNLOAD_SERIAL.print("OK ");
+  DOWNLOAD_SERIAL.print(size);
+  DOWNLOAD_SERIAL.print('\n');
+
+  // Sliding Window State
+  // Everything Before acked is Confirmed by the Host
+  uint32_t acked = offset;
+  uint32_t sent = offset;
+  uint32_t contact = millis();
+  uint8_t retries = 0;
+
+  while (acked < size)
+  {
+    // Fill Window with Next Chunk
+    if (sent < size && (sent - acked) < DOWNLOAD_WINDOW_LEN)
+    {
+      sent += SendDownloadChunk(LogFile, sent);
+    }
+
+    // Process All Complete Host Replies
+    while (DOWNLOAD_SERIAL.available() >= (int)sizeof(DownloadReply))
+    {
+      DownloadReply reply;
+      reply.type = DOWNLOAD_SERIAL.read();
+
+      // Drop Unknown Bytes to Resynchronise
+      if (reply.type != DOWNLOAD_REPLY_ACK && reply.type != DOWNLOAD_REPLY_NAK)
+      {
+        continue;
+      }
+
+      DOWNLOAD_SERIAL.readBytes((uint8_t *)&reply.offset, sizeof(uint32_t));
+
+      // Ignore Replies Outside the Current Window
+      if (reply.offset < acked || reply.offset > sent)
+      {
+        continue;
+      }
+
+      // Slide Window Forward
+      acked = reply.offset;
+      contact = millis();
+      retries = 0;
+
+      // Go Back and Resend from First Missing Byte
+      if (reply.type == DOWNLOAD_REPLY_NAK)
+      {
+        sent = reply.offset;
+      }
+    }
+
+    // Resend Window if the Host Falls Silent
+    if ((millis() - contact) > DOWNLOAD_TIMEOUT_MS)
+    {
+      // Host Disconnected, Abort and Wait for a Resume Request
+      if (++retries > DOWNLOAD_RETRIES)
+      {
+        break;
+      }
+
+      sent = acked;
+      contact = millis();
+    }
+  }
+
+  // Send End of Transfer Frame on Completion
+  if (acked == size)
+  {
+    DownloadChunkHeader header = {DOWNLOAD_FRAME_MAGIC, 0, size, 0};
+    DOWNLOAD_SERIAL.write((const uint8_t *)&header, sizeof(DownloadChunkHeader));
+  }
+
+  DOWNLOAD_SERIAL.flush();
+  LogFile.close();
+
+  // Discard Unread Replies from the Finished Transfer
+  while (DOWNLOAD_SERIAL.available() && !DownloadRequested())
+  {
+    DOWNLOAD_SERIAL.read();
+  }
+
+  // Report Outcome to GroundSide
+  PostStatus(
+    (acked == size) ? STATUS_DOWNLOAD_COMPLETE : STATUS_DOWNLOAD_ABORTED,
+    {acked},
+    FileName.c_str()
+  );
+}
@@ -0,0 +1,74 @@
+#ifndef _DOWNLOAD_H_
+#define _DOWNLOAD_H_
+// #### Library Headers
+// Fixed Width Integer Types
+#include <stdint.h>
+
+
+// #### Download Protocol Definitions
+// Host Requests a File with a Text Line on DOWNLOAD_SERIAL
+//   DOWNLOAD <File> <Offset>\n
+// FireSide Answers with a Text Line
+//   OK <Size>\n or ERR <Reason>\n
+// Then Streams DownloadChunkHeader Frames, Each Followed by length Bytes
+// A Frame with Zero length at offset = Size Ends the Transfer
+// Host Replies with DownloadReply Messages
+//   ACK: All Bytes Before offset Received, Window Slides Forward
+//   NAK: Frame at offset Lost or Corrupt, Resend from offset
+// Resume After a Disconnect by Requesting the Received Size as Offset
+// See DownloadLog.py in GroundSide for the Host Receiver
+
+// First Character of Download Request Lines
+// RYLR Lines Start with '+', so Requests are Distinguishable
+#define DOWNLOAD_REQUEST_START 'D'
+
+// Frame Synchronisation Word
+#define DOWNLOAD_FRAME_MAGIC 0XD5AAU
+
+// Frame Payload Length, Matches SD Card Sector Size
+#define DOWNLOAD_CHUNK_LEN 512U
+
+// Bytes Sent Ahead of the Last Acknowledged Offset
+#define DOWNLOAD_WINDOW_LEN (8U * DOWNLOAD_CHUNK_LEN)
+
+// Time Without Host Replies Before the Window is Resent (ms)
+#define DOWNLOAD_TIMEOUT_MS 500UL
+
+// Consecutive Resends Before the Host is Assumed Disconnected
+#define DOWNLOAD_RETRIES 10
+
+// Host Reply Types
+#define DOWNLOAD_REPLY_ACK 'A'
+#define DOWNLOAD_REPLY_NAK 'N'
+
+// Data Frame Header
+// crc is CRC-32 (IEEE 802.3) of the Payload, Same as Python's zlib.crc32
+struct __attribute__((packed)) DownloadChunkHeader {
+  uint16_t magic;
+  uint16_t length;
+  uint32_t offset;
+  uint32_t crc;
+};
+
+// Host Reply Message
+struct __attribute__((packed)) DownloadReply {
+  uint8_t type;
+  uint32_t offset;
+};
+
+
+// #### Download Functions
+// Start Download Serial Link
+void ConfigureDownload();
+
+// Check for a Pending Host Download Request
+bool DownloadRequested();
+
+// Serve One Host Download Request
+// Returns when the Transfer Completes or the Host Disconnects
+void ServeDownload();
+
+// CRC-32 of a Data Block
+uint32_t DownloadCRC(const uint8_t *Data, uint16_t Length);
+
+#endif
@@ -0,0 +1,130 @@
+// #### Library Headers
+// Arduino Framework and Data Types
+#include <Arduino.h>
+
+
+// #### Internal Headers
+// Event Queue Definitions and Function Prototypes
+#include "Events.hpp"
+
+
+// #### Internal Definitions
+// Pending Event Storage Structure
+// Timestamp is Kept as Raw Core Cycles Until the Event is Logged
+struct QueuedEvent {
+  uint16_t code;
+  uint32_t cycles;
+  uint32_t value;
+};
+
+// Circular Event Queue
+// Posted from Any Context, Drained Only by the Logging Loop
+QueuedEvent EventQueue[EVENT_QUEUE_LEN];
+
+// Next Free Slot and Oldest Pending Slot in Event Queue
+volatile uint8_t EventHead;
+volatile uint8_t EventTail;
+
+// Number of Events Dropped While Queue was Full
+volatile uint32_t EventsDropped;
+
+
+// #### Event Queue Functions
+// Start Core Cycle Counter for Event Timestamps
+void ConfigureEvents()
+{
+  // Enable Trace Unit and Data Watchpoint Cycle Counter
+  // See Page 1551 in ST's RM0394 Manual For More Implementation Details
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  // Empty Event Queue
+  EventHead = EventTail = 0;
+  EventsDropped = 0;
+}
+
+
+// Queue Event with Cycle Accurate Timestamp
+void PostEvent(uint16_t Code, uint32_t Value)
+{
+  // Latch Timestamp Before Anything Else
+  uint32_t cycles = DWT->CYCCNT;
+
+  // Claim Queue Slot with Interrupts Masked
+  // Only a Few Instructions, so Interrupt Latency is Unaffected
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  uint8_t next = (EventHead + 1) % EVENT_QUEUE_LEN;
+  if (next == EventTail)
+  {
+    // Queue Full, Drop Event
+    EventsDropped++;
+  } else {
+    EventQueue[EventHead] = {Code, cycles, Value};
+    EventHead = next;
+  }
+
+  __set_PRIMASK(primask);
+}
+
+
+// Remove Oldest Pending Event and Convert its Timestamp
+bool PopEvent(LogEventRecord &Event)
+{
+  // Report Dropped Events Once Queue has Drained
+  if (EventTail == EventHead)
+  {
+    if (EventsDropped == 0)
+    {
+      return false;
+    }
+
+    Event = {EVENT_QUEUE_OVERFLOW, 0, micros(), DWT->CYCCNT, EventsDropped};
+    EventsDropped = 0;
+    return true;
+  }
+
+  // Copy Event Before Releasing its Slot to Producers
+  QueuedEvent queued = EventQueue[EventTail];
+  EventTail = (EventTail + 1) % EVENT_QUEUE_LEN;
+
+  // Convert Cycle Timestamp to Sample Block Timebase
+  // Valid for Events Less than 53 s Old at 80 MHz Core Clock
+  uint32_t now = micros();
+  uint32_t elapsed = DWT->CYCCNT - queued.cycles;
+
+  Event.code = queued.code;
+  Event.reserved = 0;
+  Event.time = now - elapsed / (SystemCoreClock / 1000000UL);
+  Event.cycles = queued.cycles;
+  Event.value = queued.value;
+
+  return true;
+}
+
+
+// Event Code to Printable Name
+const char *EventName(uint16_t Code)
+{
+  switch (Code)
+  {
+    case EVENT_LOG_START:
+      return "LOG START";
+    case EVENT_IGNITION:
+      return "IGNITION";
+    case EVENT_LOG_STOP:
+      return "LOG STOP";
+    case EVENT_ADC_ERROR:
+      return "ADC ERROR";
+    case EVENT_SD_HIGHWATER:
+      return "SD HIGHWATER";
+    case EVENT_QUEUE_OVERFLOW:
+      return "QUEUE OVERFLOW";
+    case EVENT_FIRST_BLOCK:
+      return "FIRST BLOCK";
+    default:
+      return "UNKNOWN";
+  }
+}
@@ -0,0 +1,48 @@
+#ifndef _EVENTS_H_
+#define _EVENTS_H_
+// #### Library Headers
+// Fixed Width Integer Types
+#include <stdint.h>
+
+
+// #### Internal Headers
+// Binary Logfile Record Definitions
+#include "LogFormat.hpp"
+
+
+// #### Event Definitions
+// Logging Triggered, Value = 0
+#define EVENT_LOG_START 1
+// Igniter Pins Asserted, Value = Time Since LAUNCH Command Reception (us)
+#define EVENT_IGNITION 2
+// Stop Command Received from RYLR, Value = 0
+#define EVENT_LOG_STOP 3
+// ADC or DMA Fault, Value = HAL ADC Error Code
+#define EVENT_ADC_ERROR 4
+// Next Block Finalised Before Previous Write Finished, Value = Write Time (us)
+#define EVENT_SD_HIGHWATER 5
+// Event Queue was Full, Value = Number of Events Dropped
+#define EVENT_QUEUE_OVERFLOW 6
+// 1st Regular Block Written to SD Card, Value = Time Since Ignition (us)
+#define EVENT_FIRST_BLOCK 7
+
+// Number of Pending Events Held Before Posts are Dropped
+#define EVENT_QUEUE_LEN 32
+
+
+// #### Event Queue Functions
+// Start Core Cycle Counter for Event Timestamps
+void ConfigureEvents();
+
+// Queue Event with Cycle Accurate Timestamp
+// Safe to Call from Interrupts, Never Blocks
+void PostEvent(uint16_t Code, uint32_t Value = 0);
+
+// Remove Oldest Pending Event and Convert its Timestamp
+// Returns False if No Events are Pending
+bool PopEvent(LogEventRecord &Event);
+
+// Event Code to Printable Name
+const char *EventName(uint16_t Code);
+
+#endif
@@ -0,0 +1,251 @@
+# Python Script to Export FireSide Binary Logs as Columnar Arrays
+# Each Channel is Deinterleaved Once into One Contiguous Typed Array
+# so Analysis Notebooks can Memory Map Columns Directly
+
+#### Library Imports
+# Command Line Options
+from argparse import ArgumentParser
+
+# Sidecar Output
+from json import dump
+
+# Vectorised Deinterleaving
+import numpy as np
+from numpy.lib.format import open_memmap
+
+# Parallel Export of Runs
+from concurrent.futures import ProcessPoolExecutor, as_completed
+from os import cpu_count
+from os.path import basename, isdir, getsize, splitext
+
+# Export Timing
+from time import perf_counter
+
+# Log Indexing and Block Loading
+from AnalyseLog import IndexSegment, LoadBlocks
+from ConvertLog import FindSegments, FindRuns, EVENT_NAMES
+
+
+#### Export Settings
+# Column File Formats
+#   npy: One NumPy .npy File per Column, Load with numpy.load(mmap_mode='r')
+#   raw: One Headerless Little Endian File per Column, Load with numpy.memmap
+# Both Write a JSON Sidecar N.json Describing Every Column, Gap, Event and Sync Edge
+EXPORT_FORMATS = ['npy', 'raw']
+
+# Sample Column Types, ADC Counts are Exact in Either
+EXPORT_DTYPES = ['float32', 'uint16']
+
+# Timestamps Match the CSV 'Time (us)' Column
+TIME_DTYPE = 'int64'
+
+# Regular Blocks Deinterleaved per Pass
+CHUNK_BLOCKS = 256
+
+# Sidecar Layout Version
+SIDECAR_VERSION = 1
+
+
+#### Column Files
+# Creates a Writable Column of Rows Values
+def CreateColumn(Path, Format, DType, Rows):
+  if Format == 'npy':
+    return open_memmap(Path, mode='w+', dtype=np.dtype(DType).newbyteorder('<'), shape=(Rows,))
+
+  # np.memmap Cannot Map an Empty File
+  if not Rows:
+    open(Path, 'wb').close()
+    return np.zeros(0, dtype=DType)
+  return np.memmap(Path, mode='w+', dtype=np.dtype(DType).newbyteorder('<'), shape=(Rows,))
+
+# Column File Path and Sidecar Entry
+def ColumnFile(Base, Name, Format, DType):
+  Path = Base + '_' + Name + ('.npy' if Format == 'npy' else '.bin')
+  return Path, {'file': basename(Path), 'dtype': DType}
+
+
+#### Run Export
+# Exports All Segments of a Run to Column Files Beside N.dat
+# Regular Channels Share the 'time' Column, Slow Channels Share 'slowtime'
+# Returns Rows Written and Seconds Taken
+def ExportRun(Segments, SidecarPath, Format = 'npy', DType = 'float32'):
+  Start = perf_counter()
+  Base = splitext(SidecarPath)[0]
+  Indices = [IndexSegment(LogPath) for LogPath in Segments]
+
+  # Channel Layout from the 1st Segment, Later Segments Must Match
+  Labels = ['A' + str(Input) for Input in Indices[0]['map']]
+  SlowLabels = ['A' + str(Input) for Input in Indices[0]['slowmap']]
+  for LogPath, Index in zip(Segments, Indices):
+    if Index['map'] != Indices[0]['map'] or Index['slowmap'] != Indices[0]['slowmap']:
+      raise ValueError('Channel Map Changes in ' + LogPath)
+
+  Scans = Indices[0]['blocklength'] // Indices[0]['channels']
+  Rows = sum(len(Index['offsets']) for Index in Indices) * Scans
+
+  # Slow Scans are Whole Records of Timestamp and Samples
+  ScanType = np.dtype([('time', '<u4'), ('samples', '<u2', (len(SlowLabels),))])
+  SlowRows = sum(
+    Length // ScanType.itemsize for Index in Indices for _, Length in Index['slow']
+  ) if SlowLabels else 0
+
+  # Create Every Column Before Filling Any
+  Sidecar = {
+    'version': SIDECAR_VERSION,
+    'format': Format,
+    'byteorder': 'little',
+    'segments': [basename(LogPath) for LogPath in Segments],
+    'samplebits': Indices[0]['bits'],
+    'rows': Rows,
+    'slowrows': SlowRows,
+    'columns': {},
+    'slowcolumns': {}
+  }
+
+  Columns = {}
+  for Name, Type, Group in (
+    [('time', TIME_DTYPE, 'columns')] +
+    [(Label, DType, 'columns') for Label in Labels] +
+    ([('slowtime', TIME_DTYPE, 'slowcolumns')] if SlowLabels else []) +
+    [('slow_' + Label, DType, 'slowcolumns') for Label in SlowLabels]
+  ):
+    Path, Entry = ColumnFile(Base, Name, Format, Type)
+    Columns[Name] = CreateColumn(Path, Format, Type, Name.startswith('slow') and SlowRows or Rows)
+    Sidecar[Group][Name] = Entry
+
+  Row = 0
+  SlowRow = 0
+  Ramp = np.arange(Scans) * Indices[0]['channels']
+
+  for LogPath, Index in zip(Segments, Indices):
+    Samples = np.memmap(LogPath, dtype='<u2', mode='r', shape=(getsize(LogPath) // 2,))
+    Blocks = len(Index['offsets'])
+
+    # Deinterleave a Chunk of Blocks into Each Channel's Column
+    for First in range(0, Blocks, CHUNK_BLOCKS):
+      Chunk = np.arange(First, min(First + CHUNK_BLOCKS, Blocks))
+      Data = LoadBlocks(Samples, Index, Chunk)
+      Count = Data.shape[0] * Scans
+
+      # Same Operation Order as InterpolateTimes in ConvertLog.py
+      Last = Index['starts'][Chunk][:, None]
+      Time = Index['ends'][Chunk][:, None]
+      Columns['time'][Row:Row + Count] = (
+        ((Time - Last) * Ramp) / Index['blocklength'] + Last
+      ).astype(np.int64).ravel()
+
+      for Position, Label in enumerate(Labels):
+        Columns[Label][Row:Row + Count] = Data[:, :, Position].ravel()
+      Row += Count
+
+    # Slow Scans Keep their Own Timestamps
+    for Payload, Length in Index['slow'] if SlowLabels else []:
+      Scan = np.frombuffer(
+        Samples, dtype=ScanType, count=Length // ScanType.itemsize, offset=Payload
+      )
+      Count = len(Scan)
+      Columns['slowtime'][SlowRow:SlowRow + Count] = Scan['time']
+      for Position, Label in enumerate(SlowLabels):
+        Columns['slow_' + Label][SlowRow:SlowRow + Count] = Scan['samples'][:, Position]
+      SlowRow += Count
+
+    del Samples
+
+  for Column in Columns.values():
+    if isinstance(Column, np.memmap):
+      Column.flush()
+  del Columns
+
+  # Median Scan Period for Notebooks that Assume Uniform Sampling
+  Spans = np.concatenate([Index['ends'] - Index['starts'] for Index in Indices])
+  Sidecar['periodus'] = float(np.median(Spans)) / Scans if len(Spans) else None
+
+  # Gaps and Events Share the Microsecond Timebase of the Time Columns
+  Sidecar['gaps'] = [
+    {'start': Gap, 'resume': Resume, 'lostscans': Lost}
+    for Index in Indices for Gap, Resume, Lost in Index['gaps']
+  ]
+  Sidecar['events'] = [
+    {'time': Time, 'cycles': Cycles, 'event': EVENT_NAMES.get(Code, 'UNKNOWN'), 'value': Value}
+    for Index in Indices for Code, Time, Cycles, Value in Index['events']
+  ]
+
+  # Sync Pulse Edges are Alignment Points for Cameras and Other DAQs
+  Sidecar['syncs'] = [
+    {'time': Time, 'sequence': Sequence}
+    for Index in Indices for Time, Sequence in Index['syncs']
+  ]
+
+  # Sidecar Last, so its Presence Marks a Complete Export
+  with open(SidecarPath, 'w') as SidecarFile:
+    dump(Sidecar, SidecarFile, indent=2)
+
+  return Rows, perf_counter() - Start
+
+
+#### Batch Export
+# Exports a Run or Every Run in a Folder, Largest Runs First
+def ExportBatch(Path, Format = 'npy', DType = 'float32', Workers = None, Force = False):
+  if isdir(Path):
+    Runs = FindRuns(Path, Force, '.json')
+  else:
+    Segments = FindSegments(Path)
+    Runs = [(Segments, splitext(Segments[0])[0] + '.json')]
+
+  if not Runs:
+    print('No Logs to Export')
+    return
+
+  Runs.sort(key=lambda Run: sum(getsize(Segment) for Segment in Run[0]), reverse=True)
+
+  Summary = []
+  Start = perf_counter()
+  with ProcessPoolExecutor(max_workers=Workers) as Pool:
+    Futures = {
+      Pool.submit(ExportRun, Segments, SidecarPath, Format, DType): (Segments, SidecarPath)
+      for Segments, SidecarPath in Runs
+    }
+
+    for Future in as_completed(Futures):
+      Segments, SidecarPath = Futures[Future]
+      try:
+        Rows, Seconds = Future.result()
+      except Exception as Error:
+        print('!!!! Export Failed: ' + Segments[0] + ': ' + str(Error))
+        continue
+
+      Size = sum(getsize(Segment) for Segment in Segments)
+      Summary.append((basename(Segments[0]), Rows, Size, Seconds))
+      print('Sidecar File Location: ' + SidecarPath)
+
+  Elapsed = perf_counter() - Start
+
+  print('')
+  print('>> Export Summary')
+  print('{:<16} {:>12} {:>10} {:>10} {:>10}'.format('Log', 'Rows', 'MB', 'Seconds', 'MB/s'))
+  for Name, Rows, Size, Seconds in sorted(Summary):
+    print('{:<16} {:>12} {:>10.2f} {:>10.2f} {:>10.2f}'.format(
+      Name, Rows, Size / 1e6, Seconds, Size / 1e6 / Seconds
+    ))
+
+  print('')
+  print('Exported {} of {} Runs in {:.2f} s'.format(len(Summary), len(Runs), Elapsed))
+
+
+#### Run Export
+if __name__ == '__main__':
+  Parser = ArgumentParser(description='FireSide Binary Log Columnar Export')
+  Parser.add_argument('log', help='Binary Log File, or a Folder of Logs')
+  Parser.add_argument('--format', choices=EXPORT_FORMATS, default='npy', help='Column File Format')
+  Parser.add_argument('--dtype', choices=EXPORT_DTYPES, default='float32', help='Sample Column Type')
+  Parser.add_argument('--workers', type=int, default=cpu_count(), help='Worker Processes')
+  Parser.add_argument('--force', action='store_true', help='Export Logs with Up to Date Sidecars')
+  Options = Parser.parse_args()
+
+  # Display Script Startup
+  print('#########')
+  print('FireSide Binary Log Columnar Export')
+  print('#########')
+  print('')
+
+  ExportBatch(Options.log, Options.format, Options.dtype, Options.workers, Options.force)
@@ -16,6 +16,20 @@
 #include <SD.h>
 
 
+// #### Internal Headers
+// Compile Time ADC Channel Descriptions
+#include "Channels.hpp"
+
+// Heap Free Status Message Builder
+#include "Message.hpp"
+
+// Binary Radio Protocol Codec
+#include "Radio.hpp"
+
+// Post-Mortem Trace Ring
+#include "Trace.hpp"
+
+
 // #### HW Configuration Declarations
 // Status Pin for Visual Output
 #define STATUS_PIN 2
@@ -28,12 +42,33 @@
 #define STATUS_FIRE HIGH
 #define STATUS_SAFE LOW
 
+// Sync Pulse Input from Cameras and External DAQs
+// Edges Latch the Free Running Timer 2 Counter and are Logged, See Sync.hpp
+// D4 (PB7) is Left Free on the FireSide PCB, Wire the Pulse Source to CN3 Pin 7
+// D13 (PB3) Carries the SD Card SPI Clock, and No Free Header Pin Reaches a
+// Timer Capture Input, so Edges are Timestamped by the EXTI Interrupt
+// #define USE_SYNC_INPUT
+#define SYNC_PIN PB7
+#define SYNC_EXTI_LINE 7
+#define SYNC_EXTI_IRQ EXTI9_5_IRQn
+#define SYNC_TIMER TIM2
+
+// Replace the External Pulse Source with Software Capture Events
+// Exercises Capture, Queue and Records Without Wiring
+// #define USE_SYNC_SIMULATOR
+#define SYNC_SIM_PERIOD_MS 100UL
+
 
 // Setup Serial Communication Interface
 // RYLR998 Hardware Interface
 // See REYAX RYLR998 Datasheet for UART Configuration
 #define RYLR_UART_BAUD 115200UL
 
+// RYLR998 Network Address of this Board
+// Each FireSide on a Stand Needs its Own Address, GroundSide Discovers Them
+// Also Picks the Reply Slot for Group Commands, See Radio.hpp
+#define RYLR_ADDRESS 2
+
 // #define USE_USB_SERIAL
 #ifdef USE_USB_SERIAL
 // Redirect RYLR to USB Communications and STLink Serial
@@ -46,6 +81,30 @@
 inline HardwareSerial RYLR(RYLR_UART_RX, RYLR_UART_TX);
 #endif
 
+// Bulk Log Download over USB and STLink Serial, See Download.hpp
+#define DOWNLOAD_SERIAL Serial
+#ifdef USE_USB_SERIAL
+// Download Shares the RYLR Link and its Baud Rate
+#define DOWNLOAD_UART_BAUD RYLR_UART_BAUD
+#else
+// Highest Rate Held Reliably by the STLink Virtual COM Port
+#define DOWNLOAD_UART_BAUD 921600UL
+#endif
+
+// Start RYLR Communication and Set this Board's Network Address
+inline void ConfigureRYLR()
+{
+  RYLR.begin(RYLR_UART_BAUD);
+
+  // See +ADDRESS in REYAX AT RYLRX98 Commanding Datasheet
+  // Module Replies +OK, Skipped by ParseRYLR
+  RYLR.print("AT+ADDRESS=");
+  RYLR.print(RYLR_ADDRESS);
+  RYLR.print("\r\n");
+
+  return;
+}
+
 // Parse Incoming GroundSide Commands via RYLR Module
 inline void ParseRYLR(String &Buffer)
 {
@@ -59,6 +118,15 @@ inline void ParseRYLR(String &Buffer)
   // Load Incoming Data
   String parsed = RYLR.readStringUntil('\n');
 
+  // Skip Module Responses and Packets Not Sent by GroundSide
+  // Sender Address is the 1st Comma Separated Field of +RCV
+  if (!parsed.startsWith("+RCV=") ||
+      parsed.substring(5, parsed.indexOf(',')).toInt() != RADIO_GROUNDSIDE_ADDRESS)
+  {
+    Buffer = '\n';
+    return;
+  }
+
   // See +RCV in REYAX AT RYLRX98 Commanding Datasheet
   // Remove Data from Last 2 Fields
   parsed.remove(parsed.lastIndexOf(','));
@@ -70,62 +138,158 @@ inline void ParseRYLR(String &Buffer)
   // Strip Carriage Return
   Buffer.trim();
 
+  // Decode Binary Command Packet, See Radio.hpp
+  DecodeCommand(Buffer);
+
   return;
 }
 
 // Send Data to GroundSide via RYLR Module
-inline void SendRYLR(const String &Data)
+inline void SendRYLR(const char *Data, size_t Length)
 {
   // Issue Send AT Command
   // See +SEND in REYAX AT RYLRX98 Commanding Datasheet
-  RYLR.print("AT+SEND=0,");
-
-  // Issue Payload Length Including Header
-  RYLR.print(Data.length() + 4);
+  RYLR.print("AT+SEND=");
+  RYLR.print(RADIO_GROUNDSIDE_ADDRESS);
+  RYLR.print(',');
 
-  // Issue FireSide PCB Header
-  RYLR.print(",FS> ");
+  // Issue Payload Length
+  RYLR.print(Length);
+  RYLR.print(',');
 
   // Issue Data and Complete Command with Line End
   // CRLF Line End is Mandatory
-  RYLR.print(Data);
+  RYLR.write(Data, Length);
   RYLR.print("\r\n");
 
   return;
 }
 
+// Send Encoded Radio Packet Text to GroundSide
+// Status Messages are Sent via PostStatus, See Radio.hpp
+inline void SendRYLR(const char *Data)
+{
+  SendRYLR(Data, strlen(Data));
+}
+
+
+// Logged ADC Channels in Scan Order
+// Any Subset and Order of A0 to A5 on Pinout may be Selected
+// Each Channel may Set its Own Sample Time, See Channels.hpp
+// Example: A2 Sampled Slowly, then A0 at Default Sample Time
+//   ADCChannelMap<ADCChannel<2, ADC_SAMPLETIME_247CYCLES_5>, ADCChannel<0>>
+using ADCLoggedChannels = ADCChannelMap<
+  ADCChannel<0>,
+  ADCChannel<1>,
+  ADCChannel<2>,
+  ADCChannel<3>,
+  ADCChannel<4>,
+  ADCChannel<5>
+>;
 
 // Number of Concurrently Logged ADC Channels
-// 2 Channels Correspond to A0 & A1 on Pinout
-// 4 Channels Correspond to A0 to A3 on Pinout
-// 6 Channels Correspond to A0 to A5 on Pinout
-#define ADC_PARALLEL_CHANNELS 6
+#define ADC_PARALLEL_CHANNELS (ADCLoggedChannels::count)
 
-// See CN4 on Page 29 of MB1180 Nucleo L412KB Board User Manual
-#define MAX_PARALLEL_CHANNELS 6
-#if ADC_PARALLEL_CHANNELS < 1 || ADC_PARALLEL_CHANNELS > MAX_PARALLEL_CHANNELS
-#error "Too Few or Too Many ADC Channels Configured for Logging"
-#error "Minimum Configured Channels = 1"
-#error "Maximum Configured Channels = 6"
+// Regular Conversion Clock and Oversampling, See Channels.hpp
+// Default Averages 8 Conversions Back to 12-Bit Samples at 20 MHz
+// High Resolution Mode Keeps the Extra Bits of Oversampled Sums
+// Example: 256 Conversions Summed to 20 Bits, Shifted to 16-Bit Samples
+//   ADCConversionTiming<4, 256, 4>
+// NOTE: DMADAQ.cpp Refuses Settings the SD Card Cannot Sustain
+// #define USE_HIGHRES_ADC
+#ifdef USE_HIGHRES_ADC
+// 16 Conversions Summed to 16-Bit Samples, Half the Default Rate
+using ADCConversion = ADCConversionTiming<4, 16, 0>;
+#else
+using ADCConversion = ADCConversionTiming<4, 8, 3>;
+#endif
+
+// Bits and Full Scale Value of Stored Samples
+#define ADC_SAMPLE_BITS (ADCConversion::bits)
+#define ADC_SAMPLE_MAX ((1UL << ADC_SAMPLE_BITS) - 1UL)
+
+static_assert(
+  ADC_PARALLEL_CHANNELS >= 1 && ADC_PARALLEL_CHANNELS <= MAX_PARALLEL_CHANNELS,
+  "Too Few or Too Many ADC Channels Configured for Logging"
+);
+static_assert(
+  ADCLoggedChannels::Unique(),
+  "ADC Input Configured for Logging More than Once"
+);
+
+// Sample Slow Sensors at a Reduced Rate via the ADC Injected Group
+// Fast Channels Above Stay in the Regular DMA Scan Sequence
+// Remove Slow Inputs from ADCLoggedChannels When Enabling
+// #define USE_SLOW_CHANNELS
+#ifdef USE_SLOW_CHANNELS
+// Slowly Sampled ADC Channels in Injected Scan Order
+using ADCSlowChannels = ADCChannelMap<
+  ADCChannel<4, ADC_SAMPLETIME_247CYCLES_5>,
+  ADCChannel<5, ADC_SAMPLETIME_247CYCLES_5>
+>;
+
+// Injected Scan Trigger Period in Microseconds
+// Timer 15 Counts at 1 MHz, See ConfigureSlowChannels in DMADAQ.cpp
+#define ADC_SLOW_PERIOD_US 10000UL
+#else
+// No Slow Channels are Sampled
+using ADCSlowChannels = ADCChannelMap<>;
+#define ADC_SLOW_PERIOD_US 0UL
 #endif
 
-// ADC Pins, Channel and Rank Configuration Structure
+// Number of Slowly Sampled ADC Channels
+#define ADC_SLOW_CHANNELS (ADCSlowChannels::count)
+
+// The Injected Group Holds at Most 4 Channels
+// See Page 400 in ST's RM0394 Manual For More Implementation Details
+static_assert(
+  ADC_SLOW_CHANNELS <= 4,
+  "Too Many ADC Channels Configured for Slow Logging"
+);
+static_assert(
+  ADCSlowChannels::Unique() &&
+  ADCSlowChannels::Disjoint<ADCLoggedChannels>(),
+  "ADC Input Configured for Logging More than Once"
+);
+static_assert(
+  ADC_SLOW_PERIOD_US <= 65536UL,
+  "Slow Channel Period Exceeds 16-Bit Timer Range"
+);
+
+// ADC Pins and Channel Configuration Structure
 // Wrap HAL Defines into Arrays for Pin and Channel Configuration
 // See CN4 on Page 29 of MB1180 Nucleo L412KB Board User Manual
 struct ADCHardwareConfig {
   uint8_t pin;
   uint32_t pad;
   uint32_t channel;
-  uint32_t rank;
 };
 
-const ADCHardwareConfig ADCHardwareSetup[] = {
-  {PIN_A0, PA0, ADC_CHANNEL_5, ADC_REGULAR_RANK_1},
-  {PIN_A1, PA1, ADC_CHANNEL_6, ADC_REGULAR_RANK_2},
-  {PIN_A2, PA3, ADC_CHANNEL_8, ADC_REGULAR_RANK_3},
-  {PIN_A3, PA4, ADC_CHANNEL_9, ADC_REGULAR_RANK_4},
-  {PIN_A4, PA5, ADC_CHANNEL_10, ADC_REGULAR_RANK_5},
-  {PIN_A5, PA6, ADC_CHANNEL_11, ADC_REGULAR_RANK_6}
+constexpr ADCHardwareConfig ADCHardwareSetup[MAX_PARALLEL_CHANNELS] = {
+  {PIN_A0, PA0, ADC_CHANNEL_5},
+  {PIN_A1, PA1, ADC_CHANNEL_6},
+  {PIN_A2, PA3, ADC_CHANNEL_8},
+  {PIN_A3, PA4, ADC_CHANNEL_9},
+  {PIN_A4, PA5, ADC_CHANNEL_10},
+  {PIN_A5, PA6, ADC_CHANNEL_11}
+};
+
+// ADC Regular Sequence Ranks Assigned by Scan Position
+constexpr uint32_t ADCRegularRanks[MAX_PARALLEL_CHANNELS] = {
+  ADC_REGULAR_RANK_1,
+  ADC_REGULAR_RANK_2,
+  ADC_REGULAR_RANK_3,
+  ADC_REGULAR_RANK_4,
+  ADC_REGULAR_RANK_5,
+  ADC_REGULAR_RANK_6
+};
+
+// ADC Injected Sequence Ranks Assigned by Scan Position
+constexpr uint32_t ADCInjectedRanks[4] = {
+  ADC_INJECTED_RANK_1,
+  ADC_INJECTED_RANK_2,
+  ADC_INJECTED_RANK_3,
+  ADC_INJECTED_RANK_4
 };
 
 
@@ -147,10 +311,12 @@ inline void ErrorBlink(uint8_t CODE)
   // Set Blink Repeating Interval (ms)
   const uint16_t period = 5000;
 
-  // Assemble and Transmit Status over RYLR
-  String status = "Error Code: ";
-  status += CODE;
-  SendRYLR(status);
+  // Transmit Status over RYLR
+  PostStatus(STATUS_ERROR_CODE, {CODE});
+  FlushStatus();
+
+  // Keep History Leading Up to the Error on SD Card
+  DumpTrace(CODE);
 
   // Turn Indicator LED Off
   digitalWrite(STATUS_PIN, LOW);
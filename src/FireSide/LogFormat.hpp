@@ -0,0 +1,129 @@
+#ifndef _LOGFORMAT_H_
+#define _LOGFORMAT_H_
+// #### Library Headers
+// Fixed Width Integer Types
+#include <stdint.h>
+
+
+// #### Internal Headers
+// Compile Time ADC Channel Descriptions
+#include "Channels.hpp"
+
+
+// #### Binary Logfile Record Definitions
+// The Binary Logfile is a Sequence of Records
+// Each Record is a LogRecordHeader Followed by Length Bytes of Payload
+// NOTE: All Fields are Little Endian, See ConvertLog.py
+struct __attribute__((packed)) LogRecordHeader {
+  uint16_t type;
+  uint16_t length;
+};
+
+// Upper Byte of Every Record Type
+// Record Logs Open with a CONFIG Header, so Only the 1st Word is Checked
+// Headerless Logs Predate the Record Format and are Always 12-Bit,
+// so their 1st Sample Never Matches, 16-Bit Samples Can Match
+#define LOG_RECORD_MAGIC 0XF500U
+
+// Logfile Configuration, Always the First Record
+#define LOG_RECORD_CONFIG (LOG_RECORD_MAGIC | 0X01U)
+// Regular Group Block: uint16_t Samples[ADC_DMA_BLOCKLEN], uint32_t Timestamp
+#define LOG_RECORD_FAST (LOG_RECORD_MAGIC | 0X02U)
+// Injected Group Block: Scans of uint32_t Time, uint16_t Samples[ADC_SLOW_CHANNELS]
+#define LOG_RECORD_SLOW (LOG_RECORD_MAGIC | 0X03U)
+// Event Markers: LogEventRecord Events[], See Events.hpp
+#define LOG_RECORD_EVENT (LOG_RECORD_MAGIC | 0X04U)
+// Acquisition Gap After an ADC or DMA Fault: LogGapRecord
+#define LOG_RECORD_GAP (LOG_RECORD_MAGIC | 0X05U)
+// Logfile Segment Header, Always the Second Record: LogSegmentRecord
+#define LOG_RECORD_SEGMENT (LOG_RECORD_MAGIC | 0X06U)
+// Post-Mortem Trace Dump: TraceDumpRecord, TraceEntry Entries[], See Trace.hpp
+// Written Only to the Trace File, Never to Binary Logfiles
+#define LOG_RECORD_TRACE (LOG_RECORD_MAGIC | 0X07U)
+// Sync Pulse Edges: LogSyncRecord Edges[], See Sync.hpp
+#define LOG_RECORD_SYNC (LOG_RECORD_MAGIC | 0X08U)
+
+// Current Binary Logfile Layout Version
+#define LOG_FORMAT_VERSION 1
+
+// Configuration Record Payload
+// Describes Channel Maps so Converters Need No Build Settings
+// Sample Bits of 0 in Older Logs Mean 12-Bit Samples
+struct __attribute__((packed)) LogConfigRecord {
+  uint8_t version;
+  uint8_t fastchannels;
+  uint8_t slowchannels;
+  uint8_t samplebits;
+  uint16_t fastblocklen;
+  uint16_t slowblockscans;
+  uint32_t slowperiod;
+  uint8_t fastinputs[MAX_PARALLEL_CHANNELS];
+  uint8_t slowinputs[MAX_PARALLEL_CHANNELS];
+};
+
+// Event Marker Record Payload Entry
+// Time Shares the Microsecond Timebase of Sample Blocks
+// Cycles is the Raw Core Cycle Count when the Event was Posted
+struct __attribute__((packed)) LogEventRecord {
+  uint16_t code;
+  uint16_t reserved;
+  uint32_t time;
+  uint32_t cycles;
+  uint32_t value;
+};
+
+// Acquisition Gap Record Payload
+// No Regular Samples Exist from start to resume
+// The Next Regular Block Starts at resume Rather than at start
+struct __attribute__((packed)) LogGapRecord {
+  uint32_t start;
+  uint32_t fault;
+  uint32_t resume;
+  uint32_t lostscans;
+  uint32_t error;
+  uint32_t faults;
+};
+
+// Logfile Segment Record Payload
+// Segment 0 is N.dat, Segment K is N_K.dat for Run ID N
+// previous is the Timestamp of the Last Regular Block in Earlier Segments
+// Converters Use it to Interpolate the First Block of this Segment
+struct __attribute__((packed)) LogSegmentRecord {
+  uint16_t index;
+  uint16_t reserved;
+  uint32_t previous;
+};
+
+// Sync Pulse Edge Record Payload Entry
+// Time is the Hardware Capture Shifted onto the Timebase of Sample Blocks
+// Sequence Counts Every Captured Edge, Gaps Mark Edges that were Lost
+struct __attribute__((packed)) LogSyncRecord {
+  uint32_t time;
+  uint32_t sequence;
+};
+
+// Post-Mortem Trace Dump Header
+// Entries Follow Oldest First, Recorded Counts All Entries Since Boot
+// Cycles and Time are Latched Together at the Dump
+// Converters Use them to Place Entry Cycle Counts on the Microsecond Timebase
+struct __attribute__((packed)) TraceDumpRecord {
+  uint8_t version;
+  uint8_t error;
+  uint16_t count;
+  uint32_t recorded;
+  uint32_t cycles;
+  uint32_t time;
+  uint32_t clock;
+};
+
+// Post-Mortem Trace Entry
+// Meaning of code, arg and value Depends on kind, See Trace.hpp
+struct __attribute__((packed)) TraceEntry {
+  uint8_t kind;
+  uint8_t code;
+  uint16_t arg;
+  uint32_t cycles;
+  uint32_t value;
+};
+
+#endif
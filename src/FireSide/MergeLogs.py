@@ -0,0 +1,239 @@
+# Python Script to Merge Logs of Several FireSide Boards into One Dataset
+# Boards Launched Together by a Group LAUNCH are Aligned on Reception of that
+# Broadcast, then Refined on Shared Sync Pulse Edges where Both Logged Them
+# Every Board is Resampled onto the Scan Times of the 1st (Reference) Board
+
+#### Library Imports
+# Command Line Options
+from argparse import ArgumentParser
+
+# Alignment Summary Output
+from json import dump
+
+# Vectorised Resampling
+import numpy as np
+
+# Output Paths
+from os.path import getsize, splitext
+
+# Log Indexing, Block Loading and Event Names
+from AnalyseLog import IndexSegment, LoadBlocks, EVENT_IGNITION
+from ConvertLog import FindSegments, EVENT_NAMES
+
+
+#### Merge Settings
+# Sync Edges are Paired Only within this Fraction of the Sync Period
+# Alignment on the LAUNCH Broadcast Must be Better than this to Pair Edges
+SYNC_MATCH_FRACTION = 0.25
+
+# Merged Rows Formatted per CSV Write
+CHUNK_ROWS = 65536
+
+# Merged Event File Columns, ConvertLog's Event Columns with the Board Label
+MERGED_EVENT_FIELDS = ['Time (us)', 'Board', 'Event', 'Value']
+
+
+#### Board Logs
+# Loads All Segments of One Board's Run
+# Returns Scan Times, (Scans, Channels) Counts, Channel Labels, Events, Sync Edges and Gaps
+def LoadBoard(LogPath):
+  Segments = FindSegments(LogPath)
+  Indices = [IndexSegment(Segment) for Segment in Segments]
+
+  Channels = Indices[0]['channels']
+  Scans = Indices[0]['blocklength'] // Channels
+  Ramp = np.arange(Scans) * Channels
+
+  Times = []
+  Data = []
+  for Segment, Index in zip(Segments, Indices):
+    if not len(Index['offsets']):
+      continue
+
+    # Same Operation Order as InterpolateTimes in ConvertLog.py
+    Last = Index['starts'][:, None]
+    Time = Index['ends'][:, None]
+    Times.append((((Time - Last) * Ramp) / Index['blocklength'] + Last).astype(np.int64).ravel())
+
+    Samples = np.memmap(Segment, dtype='<u2', mode='r', shape=(getsize(Segment) // 2,))
+    Data.append(LoadBlocks(Samples, Index, np.arange(len(Index['offsets']))).reshape(-1, Channels))
+    del Samples
+
+  return {
+    'path': LogPath,
+    'labels': ['A' + str(Input) for Input in Indices[0]['map']],
+    'time': np.concatenate(Times) if Times else np.zeros(0, dtype=np.int64),
+    'data': np.concatenate(Data) if Data else np.zeros((0, Channels), dtype=np.uint16),
+    'events': [Event for Index in Indices for Event in Index['events']],
+    'syncs': np.array([Time for Index in Indices for Time, _ in Index['syncs']], dtype=np.float64),
+    'sequences': [Sequence for Index in Indices for _, Sequence in Index['syncs']],
+    'gaps': [(Start, Resume) for Index in Indices for Start, Resume, _ in Index['gaps']]
+  }
+
+# Igniter Assertion and LAUNCH Reception Times of a Board
+# The IGNITION Event Value is the Trigger Delay from Reception, See Events.hpp
+def LaunchTimes(Board):
+  for Code, Time, _, Value in Board['events']:
+    if Code == EVENT_IGNITION:
+      return Time, Time - Value
+
+  raise ValueError('No IGNITION Event in ' + Board['path'])
+
+
+#### Alignment
+# Maps Board Times onto the Reference Timebase as Reference = Rate x Board + Offset
+# Returns Alignment with Method, Sync Edges Paired and Residual in Microseconds
+def AlignBoard(Reference, Board):
+  # Every Board Received the Same Group LAUNCH Broadcast Together
+  Offset = float(LaunchTimes(Reference)[1] - LaunchTimes(Board)[1])
+  Alignment = {'rate': 1.0, 'offset': Offset, 'method': 'launch', 'pairs': 0, 'residual': None}
+
+  Edges = Reference['syncs']
+  if len(Edges) < 2 or len(Board['syncs']) < 2:
+    return Alignment
+
+  # Pair Each Board Edge with the Nearest Reference Edge
+  Period = float(np.median(np.diff(Edges)))
+  Mapped = Board['syncs'] + Offset
+  Nearest = np.clip(np.searchsorted(Edges, Mapped), 1, len(Edges) - 1)
+  Nearest -= np.abs(Edges[Nearest - 1] - Mapped) < np.abs(Edges[Nearest] - Mapped)
+  Paired = np.abs(Edges[Nearest] - Mapped) < SYNC_MATCH_FRACTION * Period
+  if Paired.sum() < 2:
+    return Alignment
+
+  # Straight Line Fit also Removes Drift Between Board Clocks
+  Rate, Offset = np.polyfit(Board['syncs'][Paired], Edges[Nearest[Paired]], 1)
+  Residual = Edges[Nearest[Paired]] - (Rate * Board['syncs'][Paired] + Offset)
+  Alignment.update({
+    'rate': float(Rate),
+    'offset': float(Offset),
+    'method': 'sync',
+    'pairs': int(Paired.sum()),
+    'residual': float(np.sqrt(np.mean(Residual ** 2)))
+  })
+
+  return Alignment
+
+# Board Time on the Reference Timebase
+def MapTime(Alignment, Time):
+  return Alignment['rate'] * np.asarray(Time, dtype=np.float64) + Alignment['offset']
+
+
+#### Merging
+# Resamples a Board's Channels onto Reference Scan Times
+# Times Outside the Board's Run or Inside its Gaps are Left Blank
+def Resample(Board, Alignment, Times):
+  Mapped = MapTime(Alignment, Board['time'])
+  Columns = np.full((len(Times), Board['data'].shape[1]), np.nan, dtype=np.float32)
+  if len(Mapped) < 2:
+    return Columns
+
+  for Position in range(Board['data'].shape[1]):
+    Columns[:, Position] = np.interp(
+      Times, Mapped, Board['data'][:, Position], left=np.nan, right=np.nan
+    )
+
+  for Start, Resume in Board['gaps']:
+    Columns[(Times >= MapTime(Alignment, Start)) & (Times < MapTime(Alignment, Resume))] = np.nan
+
+  return Columns
+
+# Merges Board Logs into One CSV File on the Reference Board's Scan Times
+# Writes Merged Events Beside it and Returns the Alignment Summary
+def MergeLogs(LogPaths, Labels, CSVPath):
+  Boards = [LoadBoard(LogPath) for LogPath in LogPaths]
+  Reference = Boards[0]
+  Alignments = [
+    {'rate': 1.0, 'offset': 0.0, 'method': 'reference', 'pairs': 0, 'residual': None}
+  ] + [AlignBoard(Reference, Board) for Board in Boards[1:]]
+
+  # Trigger Skew Measured on the Common Timebase
+  Ignition = LaunchTimes(Reference)[0]
+  Summary = {'reference': Labels[0], 'boards': {}}
+  for Label, Board, Alignment in zip(Labels, Boards, Alignments):
+    Summary['boards'][Label] = dict(
+      Alignment,
+      path=Board['path'],
+      channels=Board['labels'],
+      skew=float(MapTime(Alignment, LaunchTimes(Board)[0]) - Ignition)
+    )
+
+  # Samples of Every Board at Reference Scan Times
+  Times = Reference['time']
+  Columns = [Reference['data'].astype(np.float32)] + [
+    Resample(Board, Alignment, Times.astype(np.float64))
+    for Board, Alignment in zip(Boards[1:], Alignments[1:])
+  ]
+  FieldNames = ['Time (us)'] + [
+    Label + '_' + Channel for Label, Board in zip(Labels, Boards) for Channel in Board['labels']
+  ]
+
+  with open(CSVPath, 'w', newline='') as CSVFile:
+    CSVFile.write(','.join(FieldNames) + '\r\n')
+
+    for First in range(0, len(Times), CHUNK_ROWS):
+      Rows = slice(First, First + CHUNK_ROWS)
+      Values = np.hstack([Column[Rows] for Column in Columns])
+      Text = [
+        str(Time) + ',' + ','.join('' if Value != Value else '{:g}'.format(Value) for Value in Row)
+        for Time, Row in zip(Times[Rows], Values.tolist())
+      ]
+      CSVFile.write('\r\n'.join(Text) + '\r\n')
+
+  # Events and Sync Edges of Every Board on the Reference Timebase
+  Events = sorted(
+    [
+      (MapTime(Alignment, Time), Label, EVENT_NAMES.get(Code, 'UNKNOWN'), Value)
+      for Label, Board, Alignment in zip(Labels, Boards, Alignments)
+      for Code, Time, _, Value in Board['events']
+    ] + [
+      (MapTime(Alignment, Time), Label, 'SYNC', Sequence)
+      for Label, Board, Alignment in zip(Labels, Boards, Alignments)
+      for Time, Sequence in zip(Board['syncs'], Board['sequences'])
+    ]
+  )
+
+  EventPath = splitext(CSVPath)[0] + '_EV.csv'
+  with open(EventPath, 'w', newline='') as EventFile:
+    EventFile.write(','.join(MERGED_EVENT_FIELDS) + '\r\n')
+    for Time, Label, Name, Value in Events:
+      EventFile.write('{:.0f},{},{},{}\r\n'.format(Time, Label, Name, Value))
+
+  with open(splitext(CSVPath)[0] + '.json', 'w') as SummaryFile:
+    dump(Summary, SummaryFile, indent=2)
+
+  print('Merged File Location: ' + CSVPath)
+  print('Event File Location: ' + EventPath)
+  return Summary
+
+
+#### Run Merge
+if __name__ == '__main__':
+  Parser = ArgumentParser(description='FireSide Multi-Board Log Merge')
+  Parser.add_argument('logs', nargs='+', help='Binary Log of Each Board, Reference Board First')
+  Parser.add_argument('--labels', nargs='+', help='Column Prefix of Each Board, Defaults to B1, B2, ...')
+  Parser.add_argument('--output', default='Merged.csv', help='Merged CSV File')
+  Options = Parser.parse_args()
+
+  Labels = Options.labels or ['B' + str(Board + 1) for Board in range(len(Options.logs))]
+  if len(Labels) != len(Options.logs):
+    Parser.error('One Label is Needed per Log')
+
+  # Display Script Startup
+  print('#########')
+  print('FireSide Multi-Board Log Merge')
+  print('#########')
+  print('')
+
+  Summary = MergeLogs(Options.logs, Labels, Options.output)
+
+  print('')
+  print('>> Alignment to ' + Summary['reference'])
+  print('{:<8} {:>10} {:>16} {:>12} {:>6} {:>12} {:>12}'.format(
+    'Board', 'Method', 'Offset (us)', 'Drift (ppm)', 'Pairs', 'Residual', 'Skew (us)'
+  ))
+  for Label, Board in Summary['boards'].items():
+    print('{:<8} {:>10} {:>16.1f} {:>12.2f} {:>6} {:>12} {:>12.1f}'.format(
+      Label, Board['method'], Board['offset'], (Board['rate'] - 1) * 1e6, Board['pairs'],
+      '-' if Board['residual'] is None else '{:.1f}'.format(Board['residual']), Board['skew']
+    ))
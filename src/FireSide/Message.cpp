@@ -0,0 +1,274 @@
+// #### Library Headers
+// Arduino Framework and Data Types
+#include <Arduino.h>
+
+// Heap Statistics and Break Address
+#include <malloc.h>
+#include <unistd.h>
+
+
+// #### Internal Headers
+// Hardware Interface Definitions and Functions
+#include "Interfaces.hpp"
+
+// Message Builder Definitions and Function Prototypes
+#include "Message.hpp"
+
+
+// #### Internal Definitions
+// Static Character Arena Shared by All Messages
+char MessageArena[MESSAGE_ARENA_LEN];
+
+// Arena Characters in Use and Highest Use Seen
+uint16_t MessageArenaTop;
+uint16_t MessageArenaPeak;
+
+// Text of Messages Left Without Arena Space
+char MessageEmpty[1] = "";
+
+// Stack Watermark Pattern
+#define STACK_PAINT 0XC5C5C5C5UL
+
+// Lowest Painted Stack Word
+uint32_t *StackPaintStart;
+
+// Top of Stack from Linker Script
+extern "C" uint32_t _estack;
+
+
+// #### Heap Free Message Builder
+// Claim Capacity Characters from the Arena
+Message::Message(uint16_t Capacity)
+{
+  // Shrink Request to Remaining Arena Space
+  uint16_t available = MESSAGE_ARENA_LEN - MessageArenaTop;
+  capacity = (Capacity < available) ? Capacity : available;
+  used = 0;
+
+  // At Least a Terminator is Needed to Hold Text
+  if (capacity < 2)
+  {
+    capacity = 0;
+    text = MessageEmpty;
+    return;
+  }
+
+  text = &MessageArena[MessageArenaTop];
+  text[0] = '\0';
+
+  MessageArenaTop += capacity;
+  if (MessageArenaTop > MessageArenaPeak)
+  {
+    MessageArenaPeak = MessageArenaTop;
+  }
+}
+
+
+// Return Characters to the Arena
+Message::~Message()
+{
+  // Release Only from the Top, Matching Scope Order
+  if (capacity && text + capacity == &MessageArena[MessageArenaTop])
+  {
+    MessageArenaTop -= capacity;
+  }
+}
+
+
+// Replace Text
+Message &Message::operator=(const char *Text)
+{
+  clear();
+  return *this += Text;
+}
+
+Message &Message::operator=(char Character)
+{
+  clear();
+  return *this += Character;
+}
+
+
+// Append Text
+Message &Message::operator+=(const char *Text)
+{
+  while (*Text && (used + 1) < capacity)
+  {
+    text[used++] = *Text++;
+  }
+
+  if (capacity)
+  {
+    text[used] = '\0';
+  }
+
+  return *this;
+}
+
+Message &Message::operator+=(char Character)
+{
+  if ((used + 1) < capacity)
+  {
+    text[used++] = Character;
+    text[used] = '\0';
+  }
+
+  return *this;
+}
+
+
+// Append Decimal Numbers
+Message &Message::operator+=(unsigned char Value)
+{
+  AppendUnsigned(Value);
+  return *this;
+}
+
+Message &Message::operator+=(int Value)
+{
+  return *this += (long)Value;
+}
+
+Message &Message::operator+=(unsigned int Value)
+{
+  AppendUnsigned(Value);
+  return *this;
+}
+
+Message &Message::operator+=(long Value)
+{
+  if (Value < 0)
+  {
+    *this += '-';
+    AppendUnsigned(0UL - (unsigned long)Value);
+  } else {
+    AppendUnsigned(Value);
+  }
+
+  return *this;
+}
+
+Message &Message::operator+=(unsigned long Value)
+{
+  AppendUnsigned(Value);
+  return *this;
+}
+
+Message &Message::operator+=(double Value)
+{
+  if (Value < 0)
+  {
+    *this += '-';
+    Value = -Value;
+  }
+
+  // Round to 2 Decimals, Same as Arduino String
+  Value += 0.005;
+  unsigned long whole = (unsigned long)Value;
+  unsigned long hundredths = (unsigned long)((Value - whole) * 100.0);
+
+  AppendUnsigned(whole);
+  *this += '.';
+  *this += char('0' + hundredths / 10);
+  *this += char('0' + hundredths % 10);
+
+  return *this;
+}
+
+
+// Empty Message Text
+void Message::clear()
+{
+  used = 0;
+
+  if (capacity)
+  {
+    text[0] = '\0';
+  }
+}
+
+
+// Write Text to a Print Stream
+size_t Message::printTo(Print &Stream) const
+{
+  return Stream.write((const uint8_t *)text, used);
+}
+
+
+// Append Unsigned Decimal Digits
+void Message::AppendUnsigned(unsigned long Value)
+{
+  // Digits are Generated in Reverse Order
+  char digits[10];
+  uint8_t count = 0;
+
+  do {
+    digits[count++] = '0' + (Value % 10);
+    Value /= 10;
+  } while (Value);
+
+  while (count)
+  {
+    *this += digits[--count];
+  }
+}
+
+
+// #### Memory Usage Functions
+// Fill Free Stack with a Watermark Pattern
+void ConfigureMemoryReport()
+{
+  // Paint from Current Heap End up to Just Below Current Stack Frame
+  StackPaintStart = (uint32_t *)(((uintptr_t)sbrk(0) + 3UL) & ~3UL);
+  uint32_t *limit = (uint32_t *)(uintptr_t)(__get_MSP() - 64UL);
+
+  for (uint32_t *word = StackPaintStart; word < limit; word++)
+  {
+    *word = STACK_PAINT;
+  }
+}
+
+
+// Peak Bytes Obtained by the Heap
+// The Heap Break Never Moves Down, so its Size is the Peak
+uint32_t PeakHeapUsage()
+{
+  return mallinfo().arena;
+}
+
+
+// Peak Bytes Used by the Stack
+uint32_t PeakStackUsage()
+{
+  // Skip Words Since Claimed by the Heap
+  uint32_t *word = (uint32_t *)(((uintptr_t)sbrk(0) + 3UL) & ~3UL);
+  if (word < StackPaintStart)
+  {
+    word = StackPaintStart;
+  }
+
+  // Lowest Overwritten Word Marks Deepest Stack Use
+  while (word < &_estack && *word == STACK_PAINT)
+  {
+    word++;
+  }
+
+  return (uintptr_t)&_estack - (uintptr_t)word;
+}
+
+
+// Peak Characters Used in Message Arena
+uint16_t PeakArenaUsage()
+{
+  return MessageArenaPeak;
+}
+
+
+// Send Peak Memory Usage to GroundSide
+void ReportMemoryUsage()
+{
+  PostStatus(
+    STATUS_MEMORY_USAGE,
+    {PeakHeapUsage(), PeakStackUsage(), PeakArenaUsage()}
+  );
+}
@@ -0,0 +1,83 @@
+#ifndef _MESSAGE_H_
+#define _MESSAGE_H_
+// #### Library Headers
+// Arduino Framework Print Interface
+#include <Arduino.h>
+
+
+// #### Message Arena Definitions
+// Characters Shared by All Messages Alive at the Same Time
+// Messages are Scoped Locals, so the Arena is Used as a Stack
+#define MESSAGE_ARENA_LEN 512U
+
+// Default Characters Reserved per Message Including Terminator
+// Fits a CSV Row of All Channels or One RYLR Status Line
+#define MESSAGE_LEN 128U
+
+
+// #### Heap Free Message Builder
+// Fixed Capacity Text Built with += Like Arduino String
+// Text is Silently Truncated when Capacity is Reached
+// NOTE: Printable, so File and Serial print() Accept it Directly
+class Message : public Printable
+{
+public:
+  // Claim Capacity Characters from the Arena
+  explicit Message(uint16_t Capacity = MESSAGE_LEN);
+
+  // Return Characters to the Arena
+  ~Message();
+
+  // Messages Own Arena Space and Cannot be Copied
+  Message(const Message &) = delete;
+  Message &operator=(const Message &) = delete;
+
+  // Replace Text
+  Message &operator=(const char *Text);
+  Message &operator=(char Character);
+
+  // Append Text or Decimal Numbers
+  Message &operator+=(const char *Text);
+  Message &operator+=(char Character);
+  Message &operator+=(unsigned char Value);
+  Message &operator+=(int Value);
+  Message &operator+=(unsigned int Value);
+  Message &operator+=(long Value);
+  Message &operator+=(unsigned long Value);
+  // Floating Point Values are Appended with 2 Decimals
+  Message &operator+=(double Value);
+
+  // Empty Message Text
+  void clear();
+
+  // Null Terminated Text and Length
+  const char *c_str() const { return text; }
+  uint16_t length() const { return used; }
+
+  // Write Text to a Print Stream
+  size_t printTo(Print &Stream) const override;
+
+private:
+  // Append Unsigned Decimal Digits
+  void AppendUnsigned(unsigned long Value);
+
+  char *text;
+  uint16_t capacity;
+  uint16_t used;
+};
+
+
+// #### Memory Usage Functions
+// Fill Free Stack with a Watermark Pattern
+// Call Once at Startup Before Deep Call Chains
+void ConfigureMemoryReport();
+
+// Peak Bytes Used by Heap, Stack and Message Arena
+uint32_t PeakHeapUsage();
+uint32_t PeakStackUsage();
+uint16_t PeakArenaUsage();
+
+// Send Peak Memory Usage to GroundSide
+void ReportMemoryUsage();
+
+#endif
@@ -0,0 +1,319 @@
+// #### Library Headers
+// Arduino Framework and Data Types
+#include <Arduino.h>
+
+
+// #### Internal Headers
+// Hardware Interface Definitions and Functions
+#include "Interfaces.hpp"
+
+// Radio Protocol Definitions and Function Prototypes
+#include "Radio.hpp"
+
+
+// #### Internal Definitions
+// Outgoing Binary Packet and Bytes Used
+uint8_t RadioPacket[RADIO_PACKET_LEN];
+uint8_t RadioPacketLength;
+
+// Sequence Number of Next Outgoing Packet
+uint8_t RadioSequence;
+
+// Sequence Number of Last Accepted Command, -1 Before the First
+int16_t LastCommandSequence = -1;
+
+// Reception Time and Kind of Last Accepted Command
+uint32_t LastCommandMicros;
+bool LastCommandGroup;
+
+// Reply Slot Opening Time After a Group Command, millis() Timebase
+// Pending Until FlushStatus Finds the Queue Empty
+uint32_t ReplySlotTime;
+bool ReplySlotPending;
+
+// Set Once a Group Acknowledgement is Queued, so it is Sent Alone
+bool RadioPacketSealed;
+
+// Base64 Text Capacity Including Terminator
+#define RADIO_TEXT_LEN (((RADIO_PACKET_LEN + 2) / 3) * 4 + 1)
+
+// Each Board's Slot Recurs Once per Round of Every Slot
+#define RADIO_REPLY_ROUND_MS (RADIO_REPLY_SLOTS * RADIO_REPLY_SLOT_MS)
+
+static_assert(
+  RADIO_REPLY_SLOT_MS >= RADIO_AIRTIME_MS(RADIO_TEXT_LEN - 1) + 2U * RADIO_REPLY_GUARD_MS,
+  "Reply Slot is Shorter than a Full Packet's Airtime"
+);
+static_assert(RADIO_SPREADING_FACTOR < 11, "Airtime Assumes Low Data Rate Optimisation is Off");
+
+// Base64 Alphabet, Padding is Omitted
+const char RadioAlphabet[] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+
+// Bytes Needed to Encode Value as a Varint
+uint8_t VarintLength(uint32_t Value)
+{
+  uint8_t length = 1;
+  while (Value >>= 7)
+  {
+    length++;
+  }
+
+  return length;
+}
+
+
+// Encode Packet Bytes as Unpadded Base64 Text
+void EncodeBase64(const uint8_t *Data, uint8_t Length, char *Text)
+{
+  uint32_t bits = 0;
+  uint8_t count = 0;
+
+  for (uint8_t index = 0; index < Length; index++)
+  {
+    bits = (bits << 8) | Data[index];
+    count += 8;
+
+    while (count >= 6)
+    {
+      count -= 6;
+      *Text++ = RadioAlphabet[(bits >> count) & 0X3FU];
+    }
+  }
+
+  // Left Align Remaining Bits in Final Character
+  if (count)
+  {
+    *Text++ = RadioAlphabet[(bits << (6 - count)) & 0X3FU];
+  }
+
+  *Text = '\0';
+}
+
+
+// Decode Unpadded Base64 Text into Bytes
+// Returns Number of Bytes Decoded, or -1 on Invalid Text
+int16_t DecodeBase64(const String &Text, uint8_t *Data, uint8_t Capacity)
+{
+  uint32_t bits = 0;
+  uint8_t count = 0;
+  int16_t length = 0;
+
+  for (uint16_t index = 0; index < Text.length(); index++)
+  {
+    const char *found = strchr(RadioAlphabet, Text[index]);
+    if (!found || Text[index] == '\0')
+    {
+      return -1;
+    }
+
+    bits = (bits << 6) | (found - RadioAlphabet);
+    count += 6;
+
+    if (count >= 8)
+    {
+      count -= 8;
+      if (length >= Capacity)
+      {
+        return -1;
+      }
+      Data[length++] = (bits >> count) & 0XFFU;
+    }
+  }
+
+  return length;
+}
+
+
+// #### Radio Protocol Functions
+// Queue Status Message in Outgoing Packet
+void PostStatus(uint8_t Code, std::initializer_list<uint32_t> Values, const char *Text)
+{
+  // Size Message Payload
+  uint16_t length = Text ? strlen(Text) : 0;
+  for (uint32_t value : Values)
+  {
+    length += VarintLength(value);
+  }
+
+  // Truncate Text to Fit an Empty Packet
+  if (length > RADIO_PACKET_LEN - 3U)
+  {
+    length = RADIO_PACKET_LEN - 3U;
+  }
+
+  // Send Current Packet if Message Does not Fit or Must Go Alone
+  if (RadioPacketSealed || RadioPacketLength + 2U + length > RADIO_PACKET_LEN)
+  {
+    FlushStatus();
+  }
+
+  // Start New Packet with Sequence Number
+  if (RadioPacketLength == 0)
+  {
+    RadioPacket[RadioPacketLength++] = RadioSequence;
+  }
+
+  RadioPacket[RadioPacketLength++] = Code;
+  RadioPacket[RadioPacketLength++] = length;
+  uint8_t end = RadioPacketLength + length;
+
+  // Append Values as Varints
+  for (uint32_t value : Values)
+  {
+    do {
+      uint8_t byte = value & 0X7FU;
+      value >>= 7;
+      RadioPacket[RadioPacketLength++] = value ? (byte | 0X80U) : byte;
+    } while (value);
+  }
+
+  // Append Text Until Payload is Full
+  while (Text && *Text && RadioPacketLength < end)
+  {
+    RadioPacket[RadioPacketLength++] = *Text++;
+  }
+}
+
+
+// Send Queued Status Messages Now
+void FlushStatus()
+{
+  // Group Reply is Complete Once Nothing is Left to Send
+  if (RadioPacketLength == 0)
+  {
+    ReplySlotPending = false;
+    return;
+  }
+
+  // Hold Replies to a Group Command Until this Board's Slot Opens
+  // Each Packet Takes the Slot in the Next Round, Late Starts Wait a Round
+  if (ReplySlotPending)
+  {
+    while ((int32_t)(millis() - ReplySlotTime) > (int32_t)RADIO_REPLY_GUARD_MS)
+    {
+      ReplySlotTime += RADIO_REPLY_ROUND_MS;
+    }
+
+    int32_t wait = ReplySlotTime - millis();
+    if (wait > 0)
+    {
+      delay(wait);
+    }
+    ReplySlotTime += RADIO_REPLY_ROUND_MS;
+  }
+
+  // Encode and Transmit Packet
+  char text[RADIO_TEXT_LEN];
+  EncodeBase64(RadioPacket, RadioPacketLength, text);
+  SendRYLR(text);
+
+  // Start Next Packet
+  RadioPacketLength = 0;
+  RadioPacketSealed = false;
+  RadioSequence++;
+}
+
+
+// Decode Received Command Packet in Place and Acknowledge it
+void DecodeCommand(String &Buffer)
+{
+  // Timestamp Reception Before Decoding
+  // Group LAUNCH Trigger Delays are Measured from Here
+  uint32_t received = micros();
+
+  uint8_t packet[RADIO_PACKET_LEN];
+  int16_t length = DecodeBase64(Buffer, packet, sizeof(packet));
+
+  // Blank Buffer Unless a Valid New Command is Found
+  Buffer = '\n';
+
+  // Expect Sequence Number and One Message Header
+  if (length < 3 || packet[2] != 0)
+  {
+    return;
+  }
+
+  uint8_t sequence = packet[0];
+  bool group = packet[1] & RADIO_GROUP_COMMAND;
+  uint8_t code = packet[1] & ~RADIO_GROUP_COMMAND;
+
+  switch (code)
+  {
+    case COMMAND_SAFE:
+      Buffer = "SAFE";
+      break;
+    case COMMAND_ARM:
+      Buffer = "ARM";
+      break;
+    case COMMAND_LAUNCH:
+      Buffer = "LAUNCH";
+      break;
+    case COMMAND_CONVERT:
+      Buffer = "CONVERT";
+      break;
+    case COMMAND_PING:
+      break;
+    default:
+      // Unknown Commands are not Acknowledged
+      return;
+  }
+
+  // Every Board Hears Group Commands, Replies Wait for this Board's Slot
+  // Direct Commands are Answered at Once
+  ReplySlotPending = group;
+  if (group)
+  {
+    ReplySlotTime = millis() + (RYLR_ADDRESS % RADIO_REPLY_SLOTS) * RADIO_REPLY_SLOT_MS;
+  }
+
+  // Answer Discovery with this Board's Address and Channel Count
+  if (code == COMMAND_PING)
+  {
+    PostStatus(STATUS_BOARD, {RYLR_ADDRESS, ADC_PARALLEL_CHANNELS});
+  } else if (!group || code != COMMAND_LAUNCH) {
+    PostStatus(STATUS_ACK, {sequence});
+  }
+
+  // Acknowledge Immediately so GroundSide Stops Retrying
+  // Group Replies are Sent in this Board's Slot by the Next FlushStatus or PostStatus
+  // Not Flushed Here, Logging Polls Commands and Must Not Wait for the Slot
+  if (!group)
+  {
+    FlushStatus();
+  } else {
+    RadioPacketSealed = (RadioPacketLength != 0);
+  }
+
+  // Discovery Leaves the State Machine Undisturbed
+  if (code == COMMAND_PING)
+  {
+    return;
+  }
+
+  // Ignore Retries of an Already Accepted Command
+  if (sequence == LastCommandSequence)
+  {
+    Buffer = '\n';
+    return;
+  }
+
+  LastCommandSequence = sequence;
+  LastCommandMicros = received;
+  LastCommandGroup = group;
+}
+
+
+// Reception Time of the Last New Command
+uint32_t LastCommandTime()
+{
+  return LastCommandMicros;
+}
+
+
+// True if the Last New Command was a Group Command
+bool LastCommandWasGroup()
+{
+  return LastCommandGroup;
+}
@@ -0,0 +1,226 @@
+#ifndef _RADIO_H_
+#define _RADIO_H_
+// #### Library Headers
+// Arduino Framework String Class
+#include <Arduino.h>
+
+// Fixed Width Integer Types and Value Lists
+#include <stdint.h>
+#include <initializer_list>
+
+
+// #### Radio Packet Definitions
+// Each RYLR Payload Carries One Base64 Encoded Binary Packet
+//   uint8_t Sequence
+//   Messages, Each Laid Out as
+//     uint8_t Code
+//     uint8_t Length
+//     Varint Values[], Then Optional Text, Filling Length Bytes
+// Varints are Little Endian Base 128, 7 Bits per Byte
+// GroundSide Decodes this File for the Code Table, See RadioProtocol.py
+// NOTE: Keep Each Code Below its Display Format Comment
+
+// Binary Packet Capacity, Base64 Expands it to the 240 Byte RYLR Limit
+#define RADIO_PACKET_LEN 180U
+
+// RYLR998 Network Address of GroundSide, Boards Send Only to This Address
+// Address 0 Broadcasts to Every Module, so it is Kept for Group Commands
+#define RADIO_GROUNDSIDE_ADDRESS 1
+
+// Display Formats Use {0}, {1}, ... for Values and {text} for Text
+// Append !z for Signed Values Sent with ZigZag and :c for Hundredths
+
+
+// #### FireSide Status Codes
+// BOOTING FIRESIDE
+#define STATUS_BOOTING 0X01
+// BOOT COMPLETE
+#define STATUS_BOOT_COMPLETE 0X02
+// FIRESIDE SAFE
+#define STATUS_FIRESIDE_SAFE 0X03
+// BOOT OVERRIDE
+#define STATUS_BOOT_OVERRIDE 0X04
+// OVERRIDE SUCCESSFUL
+#define STATUS_OVERRIDE_SUCCESSFUL 0X05
+// ARMING FIRESIDE
+#define STATUS_ARMING 0X06
+// TESTING SDCARD
+#define STATUS_TESTING_SDCARD 0X07
+// FIRESIDE ARMED
+#define STATUS_ARMED 0X08
+// ARMING FAILURE
+#define STATUS_ARMING_FAILURE 0X09
+// ENSURING NO CURRENT TO IGNITERS
+#define STATUS_SAFING_IGNITERS 0X0A
+// FIRESIDE LAUNCH COMMAND
+#define STATUS_LAUNCH_COMMAND 0X0B
+// DMA GO
+#define STATUS_DMA_GO 0X0C
+// ADC GO
+#define STATUS_ADC_GO 0X0D
+// BINARY LOGGER GO
+#define STATUS_LOGGER_GO 0X0E
+// RADIO SILENCE FIRESIDE
+#define STATUS_RADIO_SILENCE 0X0F
+// SEND ANY COMMAND TO STOP LOGGING
+#define STATUS_STOP_HINT 0X10
+// FIRING IGNITERS
+#define STATUS_FIRING 0X11
+// LOGGING STOPPED
+#define STATUS_LOGGING_STOPPED 0X12
+// CONVERTING BINARY LOG
+#define STATUS_CONVERTING 0X13
+// BINARY FILENAME: {text}
+#define STATUS_BINARY_FILENAME 0X14
+// BINARY CONVERSION COMPLETE
+#define STATUS_CONVERSION_COMPLETE 0X15
+// SAFING FIRESIDE
+#define STATUS_SAFING 0X16
+// FIRESIDE FAILURE
+#define STATUS_FAILURE 0X17
+// TURNING OFF IGNITERS
+#define STATUS_TURNING_OFF_IGNITERS 0X18
+// IGNITERS OFF
+#define STATUS_IGNITERS_OFF 0X19
+// CHECKING SDCARD
+#define STATUS_CHECKING_SDCARD 0X1A
+// SAFE COMMAND RECEIVED
+#define STATUS_SAFE_RECEIVED 0X1B
+// RESETTING TO SAFE
+#define STATUS_RESETTING 0X1C
+
+// Error Code: {0}
+#define STATUS_ERROR_CODE 0X20
+// ADC CALIBRATION: {0}
+#define STATUS_ADC_CALIBRATION 0X21
+// ADC CHANNEL A{0}: {1} / {2}
+#define STATUS_ADC_CHANNEL 0X22
+// ADC OVERRUNS: {0} DMA ERRORS: {1} LOST SCANS: {2}
+#define STATUS_LOGGING_FAULTS 0X23
+// FILENAME: {text}
+#define STATUS_FILENAME 0X24
+// FILESIZE: {0}
+#define STATUS_FILESIZE 0X25
+// LOGFILE CONFIGURATION MISMATCH
+#define STATUS_CONFIG_MISMATCH 0X26
+// PROGRESS: {0} / {1} BYTES
+#define STATUS_PROGRESS 0X27
+// DOWNLOAD COMPLETE: {text} AT {0}
+#define STATUS_DOWNLOAD_COMPLETE 0X28
+// DOWNLOAD ABORTED: {text} AT {0}
+#define STATUS_DOWNLOAD_ABORTED 0X29
+// HEAP PEAK: {0} STACK PEAK: {1} ARENA PEAK: {2}
+#define STATUS_MEMORY_USAGE 0X2A
+// IGNITION TO SAMPLE: {0} NS, SAMPLING LEAD: {1} US, IGNITION TO STORED BLOCK: {2} US
+#define STATUS_LAUNCH_LATENCY 0X2B
+// ADC BURST: {0} SCANS IN {1} US
+#define STATUS_ADC_BURST 0X2C
+// ADC A{0} MEAN: {1:c} STD: {2:c} MIN: {3} MAX: {4} DRIFT: {5!z:c}
+#define STATUS_ADC_SELFTEST 0X2D
+// ADC A{0} FLOATING
+#define STATUS_ADC_FLOATING 0X2E
+// ADC A{0} SATURATED
+#define STATUS_ADC_SATURATED 0X2F
+// {text} DMA ISR CALLS: {0} CYCLES MIN: {1} MEAN: {2:c} MAX: {3} STD: {4:c} SPACING JITTER: {5}
+#define STATUS_ISR_LATENCY 0X30
+// ADC PLAN: {0} HZ PER CHANNEL, {1} BITS, {2} BYTES/S TO SD
+#define STATUS_ADC_PLAN 0X31
+// HEARTBEAT {text} UPTIME: {0} S
+#define STATUS_HEARTBEAT 0X32
+// SDCARD CHECK FAILED
+#define STATUS_SD_FAULT 0X33
+// BOARD {0}: {1} CHANNELS
+#define STATUS_BOARD 0X34
+// LAUNCH TRIGGER: {0} US FROM COMMAND TO IGNITION
+#define STATUS_LAUNCH_TRIGGER 0X35
+// QUICK LOOK: {0} BLOCKS WRITTEN OVER {1} MS
+#define STATUS_QUICKLOOK_BLOCKS 0X36
+// QUICK LOOK A{0} BASE: {1} PEAK: {2} AT {3!z} MS IMPULSE: {4} COUNT MS ABOVE THRESHOLD: {5} MS
+#define STATUS_QUICKLOOK 0X37
+
+// ACK {0}
+#define STATUS_ACK 0X7F
+
+
+// #### GroundSide Command Codes
+// Commands are Sent One per Packet and Acknowledged with STATUS_ACK
+// The Acknowledged Value is the Command Packet's Sequence Number
+// SAFE
+#define COMMAND_SAFE 0X81
+// ARM
+#define COMMAND_ARM 0X82
+// LAUNCH
+#define COMMAND_LAUNCH 0X83
+// CONVERT
+#define COMMAND_CONVERT 0X84
+// PING
+#define COMMAND_PING 0X85
+
+
+// #### Group Commands
+// GroundSide Broadcasts Group Commands to Every Board at Once
+// Group Commands Carry a Command Code with RADIO_GROUP_COMMAND Set
+// Boards Reply in their Own Slot, RYLR_ADDRESS % RADIO_REPLY_SLOTS,
+// Counted from Command Reception, so Replies do not Collide
+// PING Replies with STATUS_BOARD and is Never Acknowledged
+// Group LAUNCH is not Acknowledged, Waiting for the Slot Would Delay the Trigger
+// The Acknowledgement is Sent Alone in the Slot, Later Packets of the Reply
+// Wait for the Same Slot in Following Rounds Until the Queue Empties
+#define RADIO_GROUP_COMMAND 0X40U
+#define RADIO_REPLY_SLOTS 8U
+
+// Latest Transmission Start After a Slot Opens, and Allowance for Clock Skew
+#define RADIO_REPLY_GUARD_MS 100U
+
+// Covers a Full Packet's Airtime Between Two Guards, See Radio.cpp
+#define RADIO_REPLY_SLOT_MS 1500U
+
+
+// #### LoRa Air Rate
+// RYLR998 Defaults, AT+PARAMETER=9,7,1,12
+// Spreading Factor 9, 125 kHz Bandwidth, Coding Rate 4/5, 12 Symbol Preamble
+// Low Data Rate Optimisation Stays Off Below Spreading Factor 11
+#define RADIO_SPREADING_FACTOR 9U
+#define RADIO_BANDWIDTH_KHZ 125U
+#define RADIO_PREAMBLE_SYMBOLS 12U
+
+// Symbol Time in Microseconds
+#define RADIO_SYMBOL_US (((1UL << RADIO_SPREADING_FACTOR) * 1000UL) / RADIO_BANDWIDTH_KHZ)
+
+// Airtime of a Payload of Length Bytes in Milliseconds, Rounded Up
+// SX127x Symbol Count in Quarter Symbols, Explicit Header and Payload CRC
+// GroundSide Emulates the Same Count, See RadioProtocol.py
+#define RADIO_AIR_QUARTER_SYMBOLS(Length) \
+  (4UL * RADIO_PREAMBLE_SYMBOLS + 17UL + 4UL * (8UL + \
+  ((8UL * (Length) + 43UL) / (4UL * RADIO_SPREADING_FACTOR)) * 5UL))
+#define RADIO_AIRTIME_MS(Length) \
+  ((RADIO_AIR_QUARTER_SYMBOLS(Length) * RADIO_SYMBOL_US / 4UL + 999UL) / 1000UL)
+
+
+// #### Radio Protocol Functions
+// Map Signed Value to Unsigned so Small Magnitudes Stay Short Varints
+inline uint32_t ZigZag(int32_t Value)
+{
+  return ((uint32_t)Value << 1) ^ (uint32_t)(Value >> 31);
+}
+
+// Queue Status Message in Outgoing Packet
+// Full Packets are Sent Automatically
+void PostStatus(uint8_t Code, std::initializer_list<uint32_t> Values = {}, const char *Text = nullptr);
+
+// Send Queued Status Messages Now
+// Call Before Waiting on GroundSide or Going Silent
+// After a Group Command, Waits for this Board's Reply Slot First
+void FlushStatus();
+
+// Decode Received Command Packet in Place and Acknowledge it
+// Buffer Holds the Command Name, or is Blank for Repeats, PING and Invalid Packets
+void DecodeCommand(String &Buffer);
+
+// Reception Time of the Last New Command, micros() Timebase
+uint32_t LastCommandTime();
+
+// True if the Last New Command was a Group Command
+bool LastCommandWasGroup();
+
+#endif
@@ -0,0 +1,286 @@
+# Python Script to Replay FireSide Binary Logs through a Model of the Logging Pipeline
+# Block Completion Times Come from a Recorded Log, SD Write Times from a Latency Profile
+# Reports the Margin Left Before the Firmware Would Halt with ERR_SD_BUFF
+
+#### Library Imports
+# Command Line Options
+from argparse import ArgumentParser
+
+# Vectorised Timeline Processing
+import numpy as np
+
+# Slow Scan Timestamps and Per Block Output
+from os.path import getsize, splitext
+from csv import writer
+
+# Log Indexing and Trace Dump Decoding
+from AnalyseLog import IndexSegment
+from ConvertLog import FindSegments
+from DecodeTrace import DecodeDumps
+
+
+#### Replay Settings
+# SD Card Limits, Must Match DMADAQ.cpp
+SD_SUSTAINED_BYTES_PER_S = 300000
+SD_WRITE_STALL_US = 50000
+
+# Blocks Between Modelled Write Stalls
+# FAT Cluster Allocation and Flash Erase Stall Every Few Writes
+STALL_EVERY_BLOCKS = 16
+
+# Logging Loop Time from Block Completion to Start of its Write (us)
+LOOP_POLL_US = 5.0
+
+# Record Header Bytes and Block Timestamp Bytes, See LogFormat.hpp
+RECORD_HEADER_BYTES = 4
+BLOCK_TIME_BYTES = 4
+
+# Event Code of Block Writes that Overlapped the Next Block, See Events.hpp
+EVENT_SD_HIGHWATER = 5
+
+
+#### Replay Timeline
+# Joins Indexed Segments of a Run into One Timeline
+# Returns Block Start and End Times, Span Breaks at Gaps and Slow Block Times
+def LoadTimeline(Segments):
+  Indices = [IndexSegment(LogPath) for LogPath in Segments]
+  Starts = np.concatenate([Index['starts'] for Index in Indices])
+  Ends = np.concatenate([Index['ends'] for Index in Indices])
+
+  # Acquisition Gaps Restart the DMA, so Deadlines Never Cross Them
+  Breaks = np.flatnonzero(Starts[1:] != Ends[:-1]) + 1
+
+  # Slow Blocks Complete at the Time of their Last Scan
+  SlowTimes, SlowBytes = [], []
+  for LogPath, Index in zip(Segments, Indices):
+    if not Index['slow']:
+      continue
+
+    Samples = np.memmap(LogPath, dtype=np.uint8, mode='r', shape=(getsize(LogPath),))
+    ScanBytes = 4 + 2 * len(Index['slowmap'])
+    for Payload, Length in Index['slow']:
+      SlowTimes.append(Samples[Payload + Length - ScanBytes:][:4].view('<u4')[0])
+      SlowBytes.append(RECORD_HEADER_BYTES + Length)
+    del Samples
+
+  Highwater = sum(
+    Code == EVENT_SD_HIGHWATER for Index in Indices for Code, _, _, _ in Index['events']
+  )
+
+  return {
+    'starts': Starts,
+    'ends': Ends,
+    'breaks': Breaks,
+    'scans': Indices[0]['blocklength'] // Indices[0]['channels'],
+    'channels': Indices[0]['channels'],
+    'slowtimes': np.array(SlowTimes, dtype=np.float64),
+    'slowbytes': np.array(SlowBytes, dtype=np.float64),
+    'highwater': Highwater
+  }
+
+# Regroups Recorded Scans into Blocks of a Different Length
+# Scan Times are Interpolated Linearly Within Each Gap Free Span
+# Returns Completion Times and a Flag Marking the Last Block of Each Span
+def RegroupBlocks(Timeline, Scans):
+  Edges = [0] + list(Timeline['breaks']) + [len(Timeline['ends'])]
+  Times, Last = [], []
+
+  for First, Stop in zip(Edges[:-1], Edges[1:]):
+    if First == Stop:
+      continue
+
+    # Knots at Span Start and Each Recorded Block End
+    Knots = np.arange(Stop - First + 1) * Timeline['scans']
+    Clock = np.concatenate(([Timeline['starts'][First]], Timeline['ends'][First:Stop]))
+
+    Blocks = Knots[-1] // Scans
+    if not Blocks:
+      continue
+
+    Times.append(np.interp(np.arange(1, Blocks + 1) * Scans, Knots, Clock))
+    Last.append(np.arange(Blocks) == Blocks - 1)
+
+  return np.concatenate(Times), np.concatenate(Last)
+
+
+#### SD Write Latency Profiles
+# Write Time in Microseconds of Each Regular Block
+#   Sustained Rate, Plus a Stall Every STALL_EVERY_BLOCKS Writes
+#   Optional Gaussian Jitter as a Fraction of Each Write, Seeded for Repeatability
+#   Measured Write Times per Byte from a Trace Dump Replace the Model
+def WriteTimes(Count, Bytes, Options, Measured = None):
+  if Measured is not None and len(Measured):
+    Times = np.resize(Measured, Count) * Bytes
+  else:
+    Times = np.full(Count, Bytes * 1e6 / Options.rate)
+    Times[Options.every - 1::Options.every] += Options.stall
+
+  if Options.jitter:
+    Random = np.random.default_rng(Options.seed)
+    Times = Times * np.clip(1 + Options.jitter * Random.standard_normal(Count), 0, None)
+
+  return Times + LOOP_POLL_US
+
+
+#### Pipeline Replay
+# Replays Block Completions through the Double Buffered Logging Loop
+# Mirrors CompleteBlock and LogBuffersinLoop in DMADAQ.cpp:
+#   A Regular Block Write Starts when the Loop is Free after its Completion
+#   The Write Must End Before the Next Block Completes, or CompleteBlock Sees
+#   SDWriting and the Firmware Halts with ERR_SD_BUFF
+#   A Block Not Started Before the Next Completes is Overwritten Without Error
+#   Slow Blocks are Written After the Regular Block in the Same Loop Pass
+# Returns Per Block Write Start, Write End and Margin to the Next Completion
+def ReplayPipeline(Times, Last, Writes, SlowTimes, SlowWrites):
+  Count = len(Times)
+  Start = np.zeros(Count)
+  End = np.zeros(Count)
+  Margin = np.full(Count, np.inf)
+  Lost = np.zeros(Count, dtype=bool)
+
+  Free = -np.inf
+  Slow = 0
+  for Block in range(Count):
+    # Slow Blocks Completed While the Loop was Idle are Written First
+    while Slow < len(SlowTimes) and SlowTimes[Slow] <= Times[Block]:
+      Free = max(Free, SlowTimes[Slow]) + SlowWrites[Slow]
+      Slow += 1
+
+    Start[Block] = max(Times[Block], Free)
+    End[Block] = Start[Block] + Writes[Block]
+
+    # Next Completion is the Write Deadline Within a Span
+    if not Last[Block]:
+      Deadline = Times[Block + 1]
+      Lost[Block] = Start[Block] >= Deadline
+      Margin[Block] = Deadline - End[Block]
+
+    # Slow Blocks Ready by the End of this Write Follow it
+    Free = End[Block]
+    while Slow < len(SlowTimes) and SlowTimes[Slow] <= Free:
+      Free += SlowWrites[Slow]
+      Slow += 1
+
+  return Start, End, Margin, Lost
+
+
+# Replays One Speed and Block Length
+# Returns Summary Row and Per Block Detail
+def ReplayCase(Timeline, Speed, Scans, Options, Measured = None):
+  Times, Last = RegroupBlocks(Timeline, Scans)
+
+  # Compress Time Around the 1st Block to Replay Faster than Recorded
+  Origin = Times[0]
+  Times = Origin + (Times - Origin) / Speed
+  SlowTimes = Origin + (Timeline['slowtimes'] - Origin) / Speed
+
+  Bytes = RECORD_HEADER_BYTES + 2 * Timeline['channels'] * Scans + BLOCK_TIME_BYTES
+  Writes = WriteTimes(len(Times), Bytes, Options, Measured)
+  SlowWrites = Timeline['slowbytes'] * 1e6 / Options.rate
+
+  Start, End, Margin, Lost = ReplayPipeline(Times, Last, Writes, SlowTimes, SlowWrites)
+
+  # Overwritten Blocks were Never Written, so have No Margin
+  Checked = Margin[np.isfinite(Margin) & ~Lost]
+  Overruns = np.flatnonzero((Margin < 0) & ~Lost)
+  Period = np.median(np.diff(Times)[~Last[:-1]]) if len(Times) > 1 else 0.0
+
+  return {
+    'speed': Speed,
+    'scans': Scans,
+    'blocks': len(Times),
+    'period': Period,
+    'rate': Bytes * 1e6 / Period if Period else 0.0,
+    'write': float(np.median(Writes)),
+    'minmargin': float(Checked.min()) if len(Checked) else float('nan'),
+    'p1margin': float(np.percentile(Checked, 1)) if len(Checked) else float('nan'),
+    'overruns': len(Overruns),
+    'lost': int(Lost.sum()),
+    'firstoverrun': float(Times[Overruns[0]] - Origin) if len(Overruns) else None
+  }, (Times - Origin, Start - Origin, End - Origin, Margin)
+
+
+#### Run Replay
+if __name__ == '__main__':
+  Parser = ArgumentParser(description='FireSide Binary Log Pipeline Replay and Overrun Margin Analysis')
+  Parser.add_argument('log', help='Binary Log File, Other Segments of the Run are Included')
+  Parser.add_argument('--speed', type=float, nargs='+', default=[1.0], help='Replay Rate Multipliers')
+  Parser.add_argument('--scans', type=int, nargs='+', help='Scans per Regular Block, Default is the Logged Length')
+  Parser.add_argument('--rate', type=float, default=SD_SUSTAINED_BYTES_PER_S, help='Sustained SD Write Rate in Bytes/s')
+  Parser.add_argument('--stall', type=float, default=SD_WRITE_STALL_US, help='Modelled Write Stall in us')
+  Parser.add_argument('--every', type=int, default=STALL_EVERY_BLOCKS, help='Blocks Between Write Stalls')
+  Parser.add_argument('--jitter', type=float, default=0.0, help='Write Time Jitter as a Fraction of Each Write')
+  Parser.add_argument('--seed', type=int, default=0, help='Jitter Random Seed')
+  Parser.add_argument('--trace', help='Trace File with Measured Block Write Times, See DecodeTrace.py')
+  Parser.add_argument('--csv', action='store_true', help='Write Per Block Timeline of the 1st Case')
+  Options = Parser.parse_args()
+
+  # Display Script Startup
+  print('#########')
+  print('FireSide Binary Log Pipeline Replay')
+  print('#########')
+  print('')
+
+  Segments = FindSegments(Options.log)
+  Timeline = LoadTimeline(Segments)
+  ScanCases = Options.scans or [Timeline['scans']]
+
+  # Measured Write Times are for Blocks of the Logged Length
+  # Scaled per Byte so Other Block Lengths can be Replayed
+  Measured = None
+  if Options.trace:
+    LoggedBytes = RECORD_HEADER_BYTES + 2 * Timeline['channels'] * Timeline['scans'] + BLOCK_TIME_BYTES
+    Measured = np.array([
+      float(Detail.split()[0])
+      for _, Rows in DecodeDumps(Options.trace)
+      for _, _, _, Kind, Detail in Rows if Kind == 'BLOCK WRITE'
+    ]) / LoggedBytes
+    print('Measured Block Writes: ' + str(len(Measured)))
+
+  print('>> Replay Settings')
+  print('Log Blocks: {} of {} Scans, {} Gaps'.format(
+    len(Timeline['ends']), Timeline['scans'], len(Timeline['breaks'])
+  ))
+  print('Slow Blocks: ' + str(len(Timeline['slowtimes'])))
+  print('Logged SD Highwater Events: ' + str(Timeline['highwater']))
+  if Measured is None:
+    print('Write Profile: {:.0f} Bytes/s, {:.0f} us Stall Every {} Blocks, {:.0%} Jitter'.format(
+      Options.rate, Options.stall, Options.every, Options.jitter
+    ))
+  else:
+    print('Write Profile: Measured, {:.0%} Jitter'.format(Options.jitter))
+  print('')
+
+  print('>> Overrun Margin')
+  print('{:>6} {:>6} {:>8} {:>10} {:>10} {:>10} {:>10} {:>10} {:>8} {:>6} {:>10}'.format(
+    'Speed', 'Scans', 'Blocks', 'Period us', 'Bytes/s', 'Write us', 'Min us', 'P1 us', 'Overrun', 'Lost', 'First s'
+  ))
+
+  Detail = None
+  for Speed in Options.speed:
+    for Scans in ScanCases:
+      Summary, Timing = ReplayCase(Timeline, Speed, Scans, Options, Measured)
+      Detail = Detail or (Summary, Timing)
+      print('{speed:>6.2f} {scans:>6} {blocks:>8} {period:>10.0f} {rate:>10.0f} {write:>10.0f} {minmargin:>10.0f} {p1margin:>10.0f} {overruns:>8} {lost:>6} {0:>10}'.format(
+        '-' if Summary['firstoverrun'] is None else '{:.3f}'.format(Summary['firstoverrun'] * 1e-6), **Summary
+      ))
+
+  # Firmware Halts at the 1st Overrun, Later Ones Show How Often it Would Recur
+  print('')
+  print('Min us is the Least Time Left Between a Write Ending and the Next Block Completing')
+  print('Negative Margin Halts the Firmware with ERR_SD_BUFF at First s')
+
+  if Options.csv:
+    Summary, (Times, Start, End, Margin) = Detail
+    CSVPath = splitext(Segments[0])[0] + '_REPLAY.csv'
+    with open(CSVPath, 'w', newline='') as CSVFile:
+      ReplayWriter = writer(CSVFile, lineterminator='\r\n')
+      ReplayWriter.writerow(['Block', 'Complete (us)', 'Write Start (us)', 'Write End (us)', 'Margin (us)'])
+      for Block in range(len(Times)):
+        ReplayWriter.writerow([
+          Block, round(Times[Block], 1), round(Start[Block], 1), round(End[Block], 1),
+          round(Margin[Block], 1) if np.isfinite(Margin[Block]) else ''
+        ])
+
+    print('')
+    print('Replay Timeline File Location: ' + CSVPath)
@@ -0,0 +1,257 @@
+# Python Script to Screen FireSide Binary Logs for Combustion Instability
+
+#### Library Imports
+# Command Line Options and Graceful Script Exit
+from argparse import ArgumentParser
+from sys import exit
+
+# Vectorised Spectral Processing
+import numpy as np
+from numpy.lib.stride_tricks import sliding_window_view
+
+# Parallel Spectrogram Computation
+from concurrent.futures import ProcessPoolExecutor
+from os import cpu_count
+from os.path import getsize, splitext
+
+# Peak Report Output
+from csv import writer
+
+# Analysis Timing
+from time import perf_counter
+
+# Log Indexing and Block Loading
+from AnalyseLog import IndexSegment, LoadBlocks
+from ConvertLog import FindSegments
+
+
+#### Spectrogram Settings
+# Scans per STFT Window and Fraction Shared with the Next Window
+STFT_WINDOW = 1024
+STFT_OVERLAP = 0.5
+
+# Peaks Above the Frame's Median Level by this Many dB are Flagged
+PEAK_THRESHOLD_DB = 20.0
+
+# Ignore Bins Below this Frequency, Thrust Rise is Not an Oscillation
+PEAK_MIN_HZ = 20.0
+
+# Frames per Worker Task
+TASK_FRAMES = 512
+
+# Flagged Frames Within this Many Bins are Merged into One Episode
+EPISODE_BINS = 2
+
+# Image Dynamic Range Below Each Channel's Peak Level in dB
+IMAGE_RANGE_DB = 80.0
+
+
+#### Spectrogram Worker
+# Computes Power Spectra of Consecutive Frames for the Given Channels
+# Runs in Worker Processes, Blocks are Loaded from the Log Again
+# Returns Spectra in dB as float32, Dominant Peak Bins and Peak Prominence
+def SpectrumTask(Path, Index, Blocks, Skip, Frames, Positions, Window, Hop, MinBin):
+  Samples = np.memmap(Path, dtype='<u2', mode='r', shape=(getsize(Path) // 2,))
+  Data = LoadBlocks(Samples, Index, Blocks)
+  Data = Data.reshape(-1, Data.shape[2])[Skip:Skip + (Frames - 1) * Hop + Window]
+
+  Taper = np.hanning(Window)
+  Ramp = np.arange(Window) - (Window - 1) / 2
+  Results = []
+
+  for Position in Positions:
+    # Remove Mean and Linear Trend per Frame, so Thrust Rise and Tail Off
+    # do Not Leak into Low Frequency Bins, then Taper and Transform
+    Frame = sliding_window_view(Data[:, Position].astype(np.float64), Window)[::Hop]
+    Frame = Frame - Frame.mean(axis=1, keepdims=True)
+    Frame = (Frame - np.outer(Frame @ Ramp / (Ramp @ Ramp), Ramp)) * Taper
+    Power = np.abs(np.fft.rfft(Frame, axis=1)) ** 2
+    Level = (10 * np.log10(Power + 1e-12)).astype(np.float32)
+
+    # Dominant Peak Above Minimum Frequency and its Height over Frame Median
+    Peak = MinBin + np.argmax(Level[:, MinBin:], axis=1)
+    Prominence = Level[np.arange(len(Level)), Peak] - np.median(Level[:, MinBin:], axis=1)
+
+    Results.append((Level, Peak, Prominence))
+
+  return Results
+
+
+#### Span Planning
+# Splits Indexed Blocks into Runs of Back to Back Blocks
+# Acquisition Gaps Break the Signal, so Windows Never Cross Them
+def FindSpans(Index):
+  Breaks = np.flatnonzero(Index['starts'][1:] != Index['ends'][:-1]) + 1
+  Edges = [0] + list(Breaks) + [len(Index['offsets'])]
+  return [(Edges[Span], Edges[Span + 1]) for Span in range(len(Edges) - 1)]
+
+# Time of Each Scan Index within a Span in Microseconds
+def ScanTimes(Index, First, Scans, ScanIndices):
+  Blocks = First + ScanIndices // Scans
+  Start, End = Index['starts'][Blocks], Index['ends'][Blocks]
+  return Start + (End - Start) * (ScanIndices % Scans) / Scans
+
+
+#### Peak Episodes
+# Merges Consecutive Flagged Frames at a Similar Frequency
+# Returns (Start Time, End Time, Frequency, Peak Prominence) Rows
+def FindEpisodes(Times, Peaks, Prominence, Threshold, BinHz):
+  Episodes = []
+  Current = None
+
+  for Time, Peak, Height in zip(Times, Peaks, Prominence):
+    if Height < Threshold:
+      Current = None
+      continue
+
+    if Current and abs(Peak - Current['bin']) <= EPISODE_BINS:
+      Current['end'] = Time
+      Current['bins'].append(Peak)
+      Current['height'] = max(Current['height'], Height)
+      continue
+
+    Current = {'start': Time, 'end': Time, 'bin': Peak, 'bins': [Peak], 'height': Height}
+    Episodes.append(Current)
+
+  return [
+    (Episode['start'], Episode['end'], float(np.mean(Episode['bins'])) * BinHz, float(Episode['height']))
+    for Episode in Episodes
+  ]
+
+
+# Writes Spectrogram as 8-Bit Greyscale PGM Image
+# Time Runs Left to Right and Frequency Bottom to Top
+def WriteImage(ImagePath, Level):
+  Top = float(Level.max())
+  Scaled = np.clip((Level - (Top - IMAGE_RANGE_DB)) / IMAGE_RANGE_DB, 0, 1)
+  Pixels = (Scaled.T[::-1] * 255).astype(np.uint8)
+
+  with open(ImagePath, 'wb') as ImageFile:
+    ImageFile.write(b'P5\n%d %d\n255\n' % (Pixels.shape[1], Pixels.shape[0]))
+    ImageFile.write(Pixels.tobytes())
+
+
+#### Run Spectral Analysis
+if __name__ == '__main__':
+  Parser = ArgumentParser(description='FireSide Binary Log Spectrogram and Instability Screen')
+  Parser.add_argument('log', help='Binary Log File, Other Segments of the Run are Included')
+  Parser.add_argument('--channels', nargs='*', help='Channel Labels such as A1, Default is All Regular Channels')
+  Parser.add_argument('--window', type=int, default=STFT_WINDOW, help='Scans per STFT Window')
+  Parser.add_argument('--overlap', type=float, default=STFT_OVERLAP, help='Window Overlap Fraction')
+  Parser.add_argument('--threshold', type=float, default=PEAK_THRESHOLD_DB, help='Peak Flag Level over Frame Median in dB')
+  Parser.add_argument('--fmin', type=float, default=PEAK_MIN_HZ, help='Lowest Frequency Screened in Hz')
+  Parser.add_argument('--workers', type=int, default=cpu_count(), help='Worker Processes')
+  Options = Parser.parse_args()
+
+  # Display Script Startup
+  print('#########')
+  print('FireSide Binary Log Spectral Analysis')
+  print('#########')
+  print('')
+
+  Begin = perf_counter()
+  Segments = FindSegments(Options.log)
+  Indices = [IndexSegment(Path) for Path in Segments]
+
+  # Select Channels from the 1st Segment's Channel Map
+  Labels = ['A' + str(Input) for Input in Indices[0]['map']]
+  Selected = Options.channels or Labels
+  Positions = [Labels.index(Label) for Label in Selected]
+
+  # Per Channel Sample Period from Block Timestamps
+  Scans = Indices[0]['blocklength'] // Indices[0]['channels']
+  Period = float(np.median(np.concatenate([
+    (Index['ends'] - Index['starts']) / Scans for Index in Indices
+  ]))) * 1e-6
+  Rate = 1 / Period
+
+  Window = Options.window
+  Hop = max(1, int(Window * (1 - Options.overlap)))
+  BinHz = Rate / Window
+  MinBin = max(1, int(np.ceil(Options.fmin / BinHz)))
+
+  print('>> Spectrogram Settings')
+  print('Channels: ' + ', '.join(Selected))
+  print('Sample Rate per Channel: {:.1f} Hz'.format(Rate))
+  print('Window: {} Scans, {:.2f} ms, {:.2f} Hz Bins'.format(Window, Window * Period * 1e3, BinHz))
+  print('Hop: {} Scans'.format(Hop))
+  print('')
+
+  # Plan Tasks of Whole Frames within Gap Free Spans
+  Tasks = []
+  with ProcessPoolExecutor(max_workers=Options.workers) as Pool:
+    for Path, Index in zip(Segments, Indices):
+      for First, Last in FindSpans(Index):
+        SpanScans = (Last - First) * Scans
+        SpanFrames = max(0, (SpanScans - Window) // Hop + 1)
+
+        for Frame in range(0, SpanFrames, TASK_FRAMES):
+          Frames = min(TASK_FRAMES, SpanFrames - Frame)
+          Start = Frame * Hop
+          Stop = Start + (Frames - 1) * Hop + Window
+
+          # Blocks Holding the Task's Scans
+          Blocks = np.arange(First + Start // Scans, First + (Stop - 1) // Scans + 1)
+          Centres = ScanTimes(Index, First, Scans, Start + np.arange(Frames) * Hop + Window // 2)
+
+          # Send Workers Only the Offsets of their Blocks
+          Part = {
+            'offsets': Index['offsets'][Blocks],
+            'blocklength': Index['blocklength'],
+            'channels': Index['channels']
+          }
+
+          Tasks.append((Centres, Pool.submit(
+            SpectrumTask, Path, Part, np.arange(len(Blocks)), Start % Scans,
+            Frames, Positions, Window, Hop, MinBin
+          )))
+
+    if not Tasks:
+      print('Log is Shorter than One Window')
+      exit()
+
+    # Join Task Results in Log Order
+    Times = np.concatenate([Centres for Centres, _ in Tasks])
+    Results = [Task.result() for _, Task in Tasks]
+
+  Frequencies = np.arange(Window // 2 + 1) * BinHz
+  Base = splitext(Segments[0])[0]
+
+  # Compact Binary Output, Load with numpy.load
+  Spectra = {
+    Label: np.concatenate([Result[Channel][0] for Result in Results])
+    for Channel, Label in enumerate(Selected)
+  }
+  np.savez(
+    Base + '_SPEC.npz', times=Times, frequencies=Frequencies,
+    **{Label + '_db': Level for Label, Level in Spectra.items()}
+  )
+  print('Spectrogram File Location: ' + Base + '_SPEC.npz')
+
+  # Flag Dominant Peaks and Write One Image per Channel
+  Origin = Times[0]
+  Rows = []
+  print('')
+  print('>> Dominant Peaks Above {:.1f} dB'.format(Options.threshold))
+
+  for Channel, Label in enumerate(Selected):
+    Peaks = np.concatenate([Result[Channel][1] for Result in Results])
+    Prominence = np.concatenate([Result[Channel][2] for Result in Results])
+
+    for Start, End, Frequency, Height in FindEpisodes(Times, Peaks, Prominence, Options.threshold, BinHz):
+      Rows.append([Label, (Start - Origin) * 1e-6, (End - Origin) * 1e-6, Frequency, Height])
+      print('{:<4} {:10.3f} s to {:10.3f} s {:10.1f} Hz {:6.1f} dB'.format(*Rows[-1]))
+
+    WriteImage(Base + '_' + Label + '_SPEC.pgm', Spectra[Label])
+
+  if not Rows:
+    print('None')
+
+  with open(Base + '_PEAKS.csv', 'w', newline='') as PeakFile:
+    PeakWriter = writer(PeakFile, lineterminator='\r\n')
+    PeakWriter.writerow(['Channel', 'Start (s)', 'End (s)', 'Frequency (Hz)', 'Prominence (dB)'])
+    PeakWriter.writerows(Rows)
+
+  print('')
+  print('Peak File Location: ' + Base + '_PEAKS.csv')
+  print('Analysed in {:.2f} s'.format(perf_counter() - Begin))
@@ -10,31 +10,71 @@
 // DMA Data Logging Function Prototypes
 #include "DMADAQ.hpp"
 
+// Event Marker Queue
+#include "Events.hpp"
+
+// Bulk Log Download over Serial
+#include "Download.hpp"
+
 // Finite State Machine Definitions and Functions
 #include "States.hpp"
 
+// Cooperative Scheduler for Idle State Tasks
+#include "Tasks.hpp"
+
+
+// #### State Machine Helpers
+// Poll Once for a New GroundSide Command Without Blocking
+// Sends Queued Status and Runs One Due Task of the State First
+// Returns False if No Command is Waiting, Repeated and Invalid Packets are Skipped
+bool PollCommand(String &Command, id_t State)
+{
+  FlushStatus();
+  RunTasks(State);
+
+  if (!RYLR.available())
+  {
+    return false;
+  }
+
+  ParseRYLR(Command);
+  return Command != "\n";
+}
+
+// Wait for a New GroundSide Command, Running Tasks of the State Meanwhile
+// Used Where the False Branch of a Predicate Leaves the State
+void WaitForCommand(String &Command, id_t State)
+{
+  while (!PollCommand(Command, State))
+  {
+    // End Tick Early Once a Command Starts Arriving
+    // Keeps Group LAUNCH Reception Close to Simultaneous on Every Board
+    uint32_t tick = millis();
+    while (!RYLR.available() && (millis() - tick) < TASK_TICK_MS)
+    {
+    }
+  }
+}
+
 
 // #### BOOT State Checks and Processes
 // Check Boot State for RYLR Initialisation
 bool BootCheck(id_t state)
 {
+  // Record State Change for Post-Mortem Dumps
+  TraceState(state);
+
   // Ensure Igniter MOSFETS are Off
   digitalWrite(FIRE_PIN_A, STATUS_SAFE);
   digitalWrite(FIRE_PIN_B, STATUS_SAFE);
   digitalWrite(FIRE_PIN_C, STATUS_SAFE);
 
   // Start RYLR Communication to GroundSide PCB
-  RYLR.begin(RYLR_UART_BAUD);
+  ConfigureRYLR();
 
-  // Wait for GroundSide Contact
-  while (!RYLR.available())
-  {
-    delay(500UL);
-  }
-
-  // Parse Command from GroundSide
+  // Wait for GroundSide Contact and Parse Command
   String command;
-  ParseRYLR(command);
+  WaitForCommand(command, state);
 
   // React to GroundSide State Command
   // Proceed to SAFE State
@@ -52,7 +92,7 @@ bool BootCheck(id_t state)
 // Handle BOOT > SAFE
 void BootSafeTransition()
 {
-  SendRYLR("BOOTING FIRESIDE");
+  PostStatus(STATUS_BOOTING);
 
   // Setup Finish Pin and LED Status Indicator
   pinMode(STATUS_PIN, OUTPUT);
@@ -73,14 +113,14 @@ void BootSafeTransition()
     SD.open("Test.chk", FILE_WRITE).close();
   }
 
-  SendRYLR("BOOT COMPLETE");
-  SendRYLR("FIRESIDE SAFE");
+  PostStatus(STATUS_BOOT_COMPLETE);
+  PostStatus(STATUS_FIRESIDE_SAFE);
 }
 
 // Handle BOOT > CONVERT
 void BootConvertTransition()
 {
-  SendRYLR("BOOT OVERRIDE");
+  PostStatus(STATUS_BOOT_OVERRIDE);
 
   // Initialize Dedicated SPI Interface to SD Card
   // Abort if Initialization Fails
@@ -90,7 +130,7 @@ void BootConvertTransition()
     return;
   }
 
-  SendRYLR("OVERRIDE SUCCESSFUL");
+  PostStatus(STATUS_OVERRIDE_SUCCESSFUL);
 }
 
 
@@ -98,48 +138,84 @@ void BootConvertTransition()
 // Check if System can Proceed to ARM
 bool SafeCheck(id_t state)
 {
+  // Record State Change for Post-Mortem Dumps
+  TraceState(state);
+
   // Ensure Igniter MOSFETS are Off
   digitalWrite(FIRE_PIN_A, STATUS_SAFE);
   digitalWrite(FIRE_PIN_B, STATUS_SAFE);
   digitalWrite(FIRE_PIN_C, STATUS_SAFE);
 
-  // Wait for GroundSide Command
-  while (!RYLR.available())
+  // Stream Requested Log File to Host and Remain SAFE
+  if (DownloadRequested())
   {
-    delay(100UL);
+    ServeDownload();
+    FlushStatus();
+    return false;
   }
 
-  // Parse Command from GroundSide
+  // Remain SAFE Until GroundSide Sends a Command
+  // Idle Tasks Run Between Ticks, See Tasks.cpp
   String command;
-  ParseRYLR(command);
+  if (!PollCommand(command, state))
+  {
+    return false;
+  }
 
   // Check if GroundSide Sent Correct Command
   if (command == "ARM")
   {
-    SafeArmTransition();
-    return true;
+    // Remain SAFE if Arming Checks Fail
+    return SafeArmTransition();
   } else {
     return false;
   }
 }
 
 // Handle SAFE > ARM
-void SafeArmTransition()
+bool SafeArmTransition()
 {
-  SendRYLR("ARMING FIRESIDE");
-
-  // Check Analog Inputs
-  ReadoutAnalogPins();
+  PostStatus(STATUS_ARMING);
 
   // Ensure SD Card Functions
   // Abort on Failure
-  SendRYLR("TESTING SDCARD");
+  PostStatus(STATUS_TESTING_SDCARD);
   if (!SD.exists("Test.chk"))
   {
     ErrorBlink(ERR_SD_FILE);
   }
 
-  SendRYLR("FIRESIDE ARMED");
+  // Report Peak Memory Usage Since Boot
+  ReportMemoryUsage();
+
+  // Prepare Data Acquisition Now to Minimise LAUNCH Latency
+  // Override Configuration Mode to Continuous
+  bool ContinuousLogging = true;
+
+  // Configure DMA for Data Acquisition
+  ConfigureDMA(ContinuousLogging);
+  PostStatus(STATUS_DMA_GO);
+
+  // Configure ADC for Data Acquisition
+  ConfigureADC(ContinuousLogging);
+  PostStatus(STATUS_ADC_GO);
+
+  // Configure Logging, Calibrate ADC and Open Log File
+  ConfigureLogging();
+  PrepareLogging();
+  PostStatus(STATUS_LOGGER_GO);
+
+  // Check Analog Inputs with a Burst through the Logging Configuration
+  // Abort Arming on Floating or Saturated Inputs
+  if (!SelfTestAnalogPins())
+  {
+    PostStatus(STATUS_ARMING_FAILURE);
+    AbortLogging();
+    return false;
+  }
+
+  PostStatus(STATUS_ARMED);
+  return true;
 }
 
 
@@ -147,20 +223,18 @@ void SafeArmTransition()
 // Check if System can Proceed to LAUNCH
 bool ArmCheck(id_t state)
 {
+  // Record State Change for Post-Mortem Dumps
+  TraceState(state);
+
   // Ensure Igniter MOSFETS are Off
   digitalWrite(FIRE_PIN_A, STATUS_SAFE);
   digitalWrite(FIRE_PIN_B, STATUS_SAFE);
   digitalWrite(FIRE_PIN_C, STATUS_SAFE);
 
-  // Wait for Command from GroundSide
-  while (!RYLR.available())
-  {
-    delay(100UL);
-  }
-
-  // Parse Command from GroundSide
+  // Wait for Command from GroundSide and Parse It
+  // Any Other Command Leaves ARM, so Idle Tasks Run While Waiting
   String command;
-  ParseRYLR(command);
+  WaitForCommand(command, state);
 
   // Check if GroundSide Sent Correct Command
   if (command == "LAUNCH")
@@ -177,33 +251,22 @@ bool ArmCheck(id_t state)
 // Handle Arming Failure
 void ArmFailureTransition()
 {
-  SendRYLR("ARMING FAILURE");
+  PostStatus(STATUS_ARMING_FAILURE);
 
-  SendRYLR("ENSURING NO CURRENT TO IGNITERS");
+  PostStatus(STATUS_SAFING_IGNITERS);
   digitalWrite(FIRE_PIN_A, STATUS_SAFE);
   digitalWrite(FIRE_PIN_B, STATUS_SAFE);
   digitalWrite(FIRE_PIN_C, STATUS_SAFE);
+
+  // Discard Log File Prepared in ARM
+  AbortLogging();
 }
 
 // Handle Launch Command
 void ArmLaunchTransition()
 {
-  SendRYLR("FIRESIDE LAUNCH COMMAND");
-
-  // Override Configuration Mode to Continuous
-  bool ContinuousLogging = true;
-
-  // Configure DMA for Data Acquisition
-  ConfigureDMA(ContinuousLogging);
-  SendRYLR("DMA GO");
-
-  // Configure ADC for Data Acquisition
-  ConfigureADC(ContinuousLogging);
-  SendRYLR("ADC GO");
-
-  // Configure Logging And Get Filename
-  ConfigureLogging();
-  SendRYLR("BINARY LOGGER GO");
+  // DMA, ADC and Log File were Prepared in SafeArmTransition
+  PostStatus(STATUS_LAUNCH_COMMAND);
 }
 
 
@@ -211,11 +274,22 @@ void ArmLaunchTransition()
 // Check if LAUNCH can Proceed to LOGGING
 bool LaunchCheck(id_t state)
 {
+  // Record State Change for Post-Mortem Dumps
+  TraceState(state);
+
   // Pause FireSide RYLR Communications
   // There is not Enough CPU to Log and Communicate
-  SendRYLR("RADIO SILENCE FIRESIDE");
-  SendRYLR("SEND ANY COMMAND TO STOP LOGGING");
-  SendRYLR("FIRING IGNITERS");
+  // Group LAUNCH Skips the Notices, Flushing Would Wait for the Reply Slot
+  // GroundSide Shows them Itself, See GroundSide.py
+  if (!LastCommandWasGroup())
+  {
+    PostStatus(STATUS_RADIO_SILENCE);
+    PostStatus(STATUS_STOP_HINT);
+    PostStatus(STATUS_FIRING);
+
+    // Send Status Before Radio Silence
+    FlushStatus();
+  }
 
   // Any RYLR Input After This Point Interrupts Logging
   TriggerLogging();
@@ -225,6 +299,13 @@ bool LaunchCheck(id_t state)
   digitalWrite(FIRE_PIN_B, STATUS_FIRE);
   digitalWrite(FIRE_PIN_C, STATUS_FIRE);
 
+  // Timestamp Igniter Assertion for Latency Report
+  uint32_t trigger = MarkIgnition();
+
+  // Mark Igniter Firing in Log Event Stream
+  // Trigger Delay Lets Host Tools Align Boards Launched Together
+  PostEvent(EVENT_IGNITION, trigger);
+
   // Indicate Igniter Firing
   digitalWrite(STATUS_PIN, LOW);
 
@@ -237,6 +318,9 @@ bool LaunchCheck(id_t state)
 // Check if LOGGING is Complete
 bool LoggingCheck(id_t state)
 {
+  // Record State Change for Post-Mortem Dumps
+  TraceState(state);
+
   // Write ADC Samples in DMA Buffers to Log File
   LogBuffersinLoop();
 
@@ -248,9 +332,26 @@ bool LoggingCheck(id_t state)
 // Handle Stop of Binary Logging
 void LoggingConvertTransition()
 {
-  SendRYLR("LOGGING STOPPED");
+  PostStatus(STATUS_LOGGING_STOPPED);
+
+  // Report Quick-Look Burn Summary from Statistics Kept While Logging
+  ReportQuickLook();
+
+  // Report Recovered ADC and DMA Faults
+  ReportLoggingFaults();
+
+  // Report Measured LAUNCH Latency
+  ReportLaunchLatency();
 
-  SendRYLR("CONVERTING BINARY LOG");
+#ifdef USE_ISR_BENCHMARK
+  // Report DMA Interrupt Timing for Backend Comparison
+  ReportISRLatency();
+#endif
+
+  PostStatus(STATUS_CONVERTING);
+
+  // Send Reports Now, Not After the Lengthy CSV Conversion
+  FlushStatus();
 }
 
 
@@ -258,6 +359,9 @@ void LoggingConvertTransition()
 // Check if CSV Conversion is Complete
 bool ConvertCheck(id_t state)
 {
+  // Record State Change for Post-Mortem Dumps
+  TraceState(state);
+
   // Ensure Igniter MOSFETS are Off
   digitalWrite(FIRE_PIN_A, STATUS_SAFE);
   digitalWrite(FIRE_PIN_B, STATUS_SAFE);
@@ -300,9 +404,20 @@ bool ConvertCheck(id_t state)
   }
 
   // Start Binary Log Conversion to CSV
-  SendRYLR("BINARY FILENAME: " + FileName);
+  PostStatus(STATUS_BINARY_FILENAME, {}, FileName.c_str());
   ConvertLog(FileName);
 
+  // Convert Remaining Segments of the Run, Each to its Own CSV File
+  // See GetSegmentName in DMADAQ.cpp
+  for (uint16_t segment = 1; SD.exists(GetSegmentName(FileName, segment)); segment++)
+  {
+    PostStatus(STATUS_BINARY_FILENAME, {}, GetSegmentName(FileName, segment).c_str());
+    ConvertLog(GetSegmentName(FileName, segment));
+  }
+
+  // Next ARM Selects a Fresh Log File Name, Never this Completed Run
+  ReleaseLogfileName();
+
   // Always Proceed to SAFE State
   ConvertSafeTransition();
   return true;
@@ -311,12 +426,15 @@ bool ConvertCheck(id_t state)
 // Handle CONVERT > SAFE
 void ConvertSafeTransition()
 {
-  SendRYLR("BINARY CONVERSION COMPLETE");
+  PostStatus(STATUS_CONVERSION_COMPLETE);
+
+  // Report Peak Memory Usage Over the Logging Cycle
+  ReportMemoryUsage();
 
   // Indicate Conversion is Complete
   digitalWrite(STATUS_PIN, LOW);
 
-  SendRYLR("SAFING FIRESIDE");
+  PostStatus(STATUS_SAFING);
 }
 
 
@@ -324,22 +442,73 @@ void ConvertSafeTransition()
 // Check why System is in a Failure State
 bool FailureCheck(id_t state)
 {
-  SendRYLR("FIRESIDE FAILURE");
+  // Record State Change for Post-Mortem Dumps
+  TraceState(state);
+
+  // Diagnostics Run on Entry, and Again After a Non SAFE Command
+  static bool diagnosed = false;
+  static uint32_t rerun = 0;
+
+  if (!diagnosed)
+  {
+    // Keep Idle Tasks Running Until Diagnostics are Due
+    if (!RunDiagnostics(rerun))
+    {
+      RunTasks(state);
+      return false;
+    }
+
+    diagnosed = true;
+  }
+
+  // Remain in FAILURE Until GroundSide Sends a Command
+  String command;
+  if (!PollCommand(command, state))
+  {
+    return false;
+  }
+
+  // Check Received Command
+  diagnosed = false;
+  if (command == "SAFE")
+  {
+    // Only Proceed on Receipt of Safe Command
+    PostStatus(STATUS_SAFE_RECEIVED);
+    PostStatus(STATUS_RESETTING);
+    rerun = millis();
+    return true;
+  } else {
+    // Rerun Diagnostics After 5 s Without Blocking
+    rerun = millis() + 5000UL;
+    return false;
+  }
+}
+
+// Run FAILURE Diagnostics Once the Rerun Time is Reached
+// Returns False if Diagnostics are Not Yet Due or Fail
+bool RunDiagnostics(uint32_t Rerun)
+{
+  if ((int32_t)(millis() - Rerun) < 0)
+  {
+    return false;
+  }
+
+  PostStatus(STATUS_FAILURE);
 
   // Turn Off Igniter MOSFETS
-  SendRYLR("TURNING OFF IGNITERS");
+  PostStatus(STATUS_TURNING_OFF_IGNITERS);
   digitalWrite(FIRE_PIN_A, STATUS_SAFE);
   digitalWrite(FIRE_PIN_B, STATUS_SAFE);
   digitalWrite(FIRE_PIN_C, STATUS_SAFE);
 
   // Indicate Igniter Status
   digitalWrite(STATUS_PIN, HIGH);
-  SendRYLR("IGNITERS OFF");
+  PostStatus(STATUS_IGNITERS_OFF);
 
   // Check SD Card Status
   // Reinitialize Dedicated SPI Interface to SD Card
   // Abort if Initialization Fails
-  SendRYLR("CHECKING SDCARD");
+  PostStatus(STATUS_CHECKING_SDCARD);
   SD.end();
   if (!SD.begin(F_CPU / 4, SD_CHIP_SELECT_PIN))
   {
@@ -349,7 +518,7 @@ bool FailureCheck(id_t state)
 
   // Ensure SD Card Functions
   // Abort on Failure
-  SendRYLR("TESTING SDCARD");
+  PostStatus(STATUS_TESTING_SDCARD);
   if (!SD.exists("Test.chk"))
   {
     ErrorBlink(ERR_SD_FILE);
@@ -358,27 +527,5 @@ bool FailureCheck(id_t state)
 
   // Check Analog Inputs
   ReadoutAnalogPins();
-
-  // Wait for GroundSide Command
-  while (!RYLR.available())
-  {
-    delay(500UL);
-  }
-
-  // Parse Command from GroundSide
-  String command;
-  ParseRYLR(command);
-
-  // Check Received Command
-  if (command == "SAFE")
-  {
-    // Only Proceed on Receipt of Safe Command
-    SendRYLR("SAFE COMMAND RECEIVED");
-    SendRYLR("RESETTING TO SAFE");
-    return true;
-  } else {
-    // Rerun Diagnostics
-    delay(5000UL);
-    return false;
-  }
+  return true;
 }
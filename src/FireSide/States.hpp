@@ -1,6 +1,9 @@
 #ifndef _STATES_H_
 #define _STATES_H_
 // #### Library Headers
+// Arduino Framework String Class
+#include <Arduino.h>
+
 // Finite State Machine State ID Definitions
 #include <FiniteState.h>
 
@@ -19,6 +22,19 @@ enum States : id_t
 };
 
 
+// #### State Machine Helpers
+// Poll Once for a New GroundSide Command Without Blocking
+// Returns False if No Command is Waiting
+bool PollCommand(String &Command, id_t State);
+
+// Wait for a New GroundSide Command, Running Tasks of the State Meanwhile
+void WaitForCommand(String &Command, id_t State);
+
+// Run FAILURE Diagnostics Once the Rerun Time is Reached
+// Returns False if Diagnostics are Not Yet Due or Fail
+bool RunDiagnostics(uint32_t Rerun);
+
+
 // #### State Machine Predicates
 // Check if Boot can Proceed to SAFE
 bool BootCheck(id_t state);
@@ -50,7 +66,8 @@ void BootSafeTransition();
 void BootConvertTransition();
 
 // Handle SAFE > ARM
-void SafeArmTransition();
+// Returns False if Arming Checks Fail
+bool SafeArmTransition();
 
 // Handle Arming Failure
 void ArmFailureTransition();
@@ -0,0 +1,113 @@
+// #### Library Headers
+// Arduino Framework and Hardware Timer Driver
+#include <Arduino.h>
+
+
+// #### Internal Headers
+// Hardware Interface Definitions and Functions
+#include "Interfaces.hpp"
+
+// Sync Capture Definitions and Function Prototypes
+#include "Sync.hpp"
+
+
+#ifdef USE_SYNC_INPUT
+// #### Internal Definitions
+// Free Running Timebase for Sync Edges
+// The Arduino Core Owns the Timer 2 Interrupt, so its Driver is Used Here
+HardwareTimer SyncTimer(SYNC_TIMER);
+
+// Circular Edge Queue
+// Filled by the Edge Interrupt, Drained Only by the Logging Loop
+LogSyncRecord SyncQueue[SYNC_QUEUE_LEN];
+
+// Next Free Slot and Oldest Pending Slot in Edge Queue
+volatile uint8_t SyncHead;
+volatile uint8_t SyncTail;
+
+// Edges Captured Since Logging was Triggered
+volatile uint32_t SyncSequence;
+
+// Offset from Timebase Ticks to micros()
+volatile uint32_t SyncOffset;
+
+
+// #### Sync Edge Interrupt
+// Queue Edge on the Sample Block Timebase
+void SyncCaptured()
+{
+  // Latch Timebase First, Before Any Other Work in the Handler
+  uint32_t capture = SYNC_TIMER->CNT;
+
+  uint8_t next = (SyncHead + 1) % SYNC_QUEUE_LEN;
+  if (next != SyncTail)
+  {
+    SyncQueue[SyncHead] = {capture + SyncOffset, SyncSequence};
+    SyncHead = next;
+  }
+
+  // Dropped Edges Also Advance the Sequence
+  SyncSequence++;
+}
+
+
+// #### Sync Capture Functions
+// Start Free Running Timebase and Edge Interrupt on the Sync Pin
+void ConfigureSync()
+{
+  // 32-Bit Counter Ticking in Microseconds, Wraps with micros()
+  SyncTimer.setPrescaleFactor(SyncTimer.getTimerClkFreq() / SYNC_TIMER_HZ);
+  SyncTimer.setOverflow(0XFFFFFFFFUL);
+  SyncTimer.resume();
+
+  // Rising Edges on the Sync Pin, Pulled Down While Unconnected
+  pinMode(SYNC_PIN, INPUT_PULLDOWN);
+  attachInterrupt(digitalPinToInterrupt(SYNC_PIN), SyncCaptured, RISING);
+
+  // Above DMA and ADC Interrupts, Edges are Timestamped on Entry
+  HAL_NVIC_SetPriority(SYNC_EXTI_IRQ, SYNC_IRQ_PRIORITY, 0);
+}
+
+
+// Align Timebase to micros() and Discard Stale Edges
+void AlignSync()
+{
+  // Latch Both Clocks Together
+  // Both Run from the Core Clock, so the Offset Holds for the Whole Run
+  noInterrupts();
+  SyncOffset = micros() - SYNC_TIMER->CNT;
+  SyncHead = SyncTail = 0;
+  SyncSequence = 0;
+  interrupts();
+}
+
+
+// Remove Oldest Pending Edge
+bool PopSync(LogSyncRecord &Sync)
+{
+  if (SyncTail == SyncHead)
+  {
+    return false;
+  }
+
+  Sync = SyncQueue[SyncTail];
+  SyncTail = (SyncTail + 1) % SYNC_QUEUE_LEN;
+  return true;
+}
+
+
+#ifdef USE_SYNC_SIMULATOR
+// Raise a Software Edge Interrupt Every SYNC_SIM_PERIOD_MS
+// Runs the Same Handler as a Pin Edge Would
+void SimulateSync()
+{
+  static uint32_t last = 0;
+
+  if ((millis() - last) >= SYNC_SIM_PERIOD_MS)
+  {
+    last = millis();
+    EXTI->SWIER1 = 1UL << SYNC_EXTI_LINE;
+  }
+}
+#endif
+#endif
@@ -0,0 +1,45 @@
+#ifndef _SYNC_H_
+#define _SYNC_H_
+// #### Library Headers
+// Fixed Width Integer Types
+#include <stdint.h>
+
+
+// #### Internal Headers
+// Sync Pin and Simulator Toggles
+#include "Interfaces.hpp"
+
+// Binary Logfile Record Definitions
+#include "LogFormat.hpp"
+
+
+// #### Sync Capture Settings
+// Number of Pending Edges Held Before Captures are Dropped
+#define SYNC_QUEUE_LEN 32
+
+// Timebase Tick Rate, Matches the micros() Timebase of Sample Blocks
+#define SYNC_TIMER_HZ 1000000UL
+
+// Edge Interrupt Preempts DMA and ADC Interrupts to Bound Timestamp Latency
+// Constant Entry Latency is Common to Every Edge, so Only Jitter Matters
+#define SYNC_IRQ_PRIORITY 0U
+
+
+// #### Sync Capture Functions
+// Start Free Running Timebase and Edge Interrupt on the Sync Pin
+void ConfigureSync();
+
+// Align Timebase to micros() and Discard Stale Edges
+// Called Just Before Logging is Triggered
+void AlignSync();
+
+// Remove Oldest Pending Edge
+// Returns False if No Edges are Pending
+bool PopSync(LogSyncRecord &Sync);
+
+#ifdef USE_SYNC_SIMULATOR
+// Raise a Software Edge Interrupt Every SYNC_SIM_PERIOD_MS
+void SimulateSync();
+#endif
+
+#endif
@@ -0,0 +1,116 @@
+// #### Library Headers
+// Arduino Framework and Data Types
+#include <Arduino.h>
+
+
+// #### Internal Headers
+// Hardware Interface Definitions and Functions
+#include "Interfaces.hpp"
+
+// DMA Data Logging Function Prototypes
+#include "DMADAQ.hpp"
+
+// Finite State Machine Definitions and Functions
+#include "States.hpp"
+
+// Cooperative Scheduler Settings and Function Prototypes
+#include "Tasks.hpp"
+
+
+// #### Periodic Tasks
+// Report State and Uptime so GroundSide Sees the Link is Alive
+void HeartbeatTask(id_t State)
+{
+  // Printable State Names in States Enum Order
+  static const char *const StateNames[] =
+  {
+    "BOOT", "SAFE", "ARM", "LAUNCH", "LOGGING", "CONVERT", "FAILURE"
+  };
+
+  PostStatus(STATUS_HEARTBEAT, {millis() / 1000U}, StateNames[State]);
+}
+
+// Check the SD Card Still Responds While Idle
+// Reports Once per Fault, so a Removed Card does Not Flood the Radio
+void SDCheckTask(id_t State)
+{
+  static bool faulted = false;
+
+  bool healthy = SD.exists("Test.chk");
+  if (!healthy && !faulted)
+  {
+    PostStatus(STATUS_SD_FAULT);
+  }
+
+  faulted = !healthy;
+}
+
+// Select the Next Free Log File Name in SAFE
+// Moves the File Name Search Out of the Arming Sequence
+void LogfileNameTask(id_t State)
+{
+  // Cached Until Released After CONVERT or an Aborted ARM, See DMADAQ.cpp
+  GetLogfileName(true);
+}
+
+// Recalibrate the Idle ADC While ARMed
+void ADCWarmupTask(id_t State)
+{
+  RefreshCalibration();
+}
+
+
+// #### Task Table
+// Periodic Task Description
+struct ScheduledTask {
+  void (*run)(id_t State);
+  uint32_t period;
+  uint8_t states;
+  uint32_t last;
+};
+
+// Tasks Run Only in States Enabled by their Mask
+ScheduledTask TaskTable[] =
+{
+  {  HeartbeatTask,  TASK_HEARTBEAT_MS, TASK_IN(SAFE) | TASK_IN(ARM) | TASK_IN(FAILURE), 0},
+  {    SDCheckTask,   TASK_SD_CHECK_MS, TASK_IN(SAFE) | TASK_IN(ARM),                    0},
+  {LogfileNameTask,   TASK_SD_CHECK_MS, TASK_IN(SAFE),                                   0},
+  {  ADCWarmupTask, TASK_ADC_WARMUP_MS, TASK_IN(ARM),                                    0}
+};
+
+// Calculate Total Number of Tasks
+const uint8_t TotalTasks = sizeof(TaskTable) / sizeof(ScheduledTask);
+
+
+// #### Cooperative Scheduler
+// Run the Most Overdue Periodic Task Enabled in the Given State
+void RunTasks(id_t State)
+{
+  uint32_t now = millis();
+
+  // Find the Task Furthest Past its Due Time
+  ScheduledTask *due = nullptr;
+  uint32_t lateness = 0;
+  for (uint8_t task = 0; task < TotalTasks; task++)
+  {
+    if (!(TaskTable[task].states & TASK_IN(State)))
+    {
+      continue;
+    }
+
+    uint32_t elapsed = now - TaskTable[task].last;
+    if (elapsed >= TaskTable[task].period && (!due || elapsed - TaskTable[task].period > lateness))
+    {
+      due = &TaskTable[task];
+      lateness = elapsed - TaskTable[task].period;
+    }
+  }
+
+  if (!due)
+  {
+    return;
+  }
+
+  due->last = now;
+  due->run(State);
+}
@@ -0,0 +1,31 @@
+#ifndef _TASKS_H_
+#define _TASKS_H_
+// #### Library Headers
+// Finite State Machine State ID Definitions
+#include <FiniteState.h>
+
+
+// #### Scheduler Settings
+// Interval Between Heartbeat Status Messages (ms)
+#define TASK_HEARTBEAT_MS 10000UL
+
+// Interval Between SD Card Health Checks (ms)
+#define TASK_SD_CHECK_MS 5000UL
+
+// Interval Between Idle ADC Recalibrations in ARM (ms)
+// Tracks Calibration Drift as the Board Warms Up Before LAUNCH
+#define TASK_ADC_WARMUP_MS 15000UL
+
+// Delay Between Ticks of States Waiting for a Command (ms)
+#define TASK_TICK_MS 10UL
+
+// Task State Mask Helper
+#define TASK_IN(State) (1U << (State))
+
+
+// #### Cooperative Scheduler Functions
+// Run the Most Overdue Periodic Task Enabled in the Given State
+// Runs at Most One Task per Call to Keep Each FSM Tick Short
+void RunTasks(id_t State);
+
+#endif
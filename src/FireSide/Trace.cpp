@@ -0,0 +1,133 @@
+// #### Library Headers
+// Arduino Framework and Data Types
+#include <Arduino.h>
+
+
+// #### Internal Headers
+// Hardware Interface Definitions and Functions
+#include "Interfaces.hpp"
+
+// Trace Ring Definitions and Function Prototypes
+#include "Trace.hpp"
+
+
+// #### Internal Definitions
+// Ring Slots Must Stay Aligned when the Recorded Count Wraps
+static_assert(
+  (TRACE_RING_LEN & (TRACE_RING_LEN - 1)) == 0,
+  "TRACE_RING_LEN Must be a Power of 2"
+);
+
+// Circular Trace Ring
+// Written from Any Context, Read Only by DumpTrace
+TraceEntry TraceRing[TRACE_RING_LEN];
+
+// Total Entries Recorded Since Boot
+// Next Slot is TraceRecorded % TRACE_RING_LEN
+volatile uint32_t TraceRecorded;
+
+// Set Once a Dump Starts, Later Entries are Dropped
+volatile bool TraceFrozen;
+
+
+// #### Trace Ring Functions
+// Record Entry with Cycle Accurate Timestamp
+void Trace(uint8_t Kind, uint8_t Code, uint16_t Arg, uint32_t Value)
+{
+  // Latch Timestamp Before Anything Else
+  uint32_t cycles = DWT->CYCCNT;
+
+  // Claim Ring Slot with Interrupts Masked
+  // Only a Few Instructions, so Interrupt Latency is Unaffected
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (TraceFrozen)
+  {
+    __set_PRIMASK(primask);
+    return;
+  }
+
+  TraceRing[TraceRecorded % TRACE_RING_LEN] = {Kind, Code, Arg, cycles, Value};
+  TraceRecorded++;
+
+  __set_PRIMASK(primask);
+}
+
+
+// Record FSM State Only When it Changes
+void TraceState(uint8_t State)
+{
+  static int16_t last = -1;
+
+  if (State != last)
+  {
+    Trace(TRACE_STATE, State);
+    last = State;
+  }
+}
+
+
+// Record HAL Call Result and Pass it Through
+HAL_StatusTypeDef TraceHAL(uint16_t Line, HAL_StatusTypeDef Status)
+{
+  Trace(TRACE_HAL, Status, Line);
+  return Status;
+}
+
+
+// Append Trace Ring to the Trace File Before Halting
+void DumpTrace(uint8_t Error)
+{
+  // SD Failures Inside the Dump Call ErrorBlink Again
+  if (TraceFrozen)
+  {
+    return;
+  }
+
+  Trace(TRACE_ERROR, Error);
+
+  // Freeze Ring and Latch Dump Timebase Together
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  TraceFrozen = true;
+
+  uint32_t recorded = TraceRecorded;
+  TraceDumpRecord header = {
+    TRACE_FORMAT_VERSION,
+    Error,
+    (uint16_t)(recorded < TRACE_RING_LEN ? recorded : TRACE_RING_LEN),
+    recorded,
+    DWT->CYCCNT,
+    micros(),
+    SystemCoreClock
+  };
+
+  __set_PRIMASK(primask);
+
+  // Keep Earlier Dumps, Each is One Record
+  File TraceFile = SD.open(TRACE_FILE, FILE_WRITE);
+  if (!TraceFile)
+  {
+    return;
+  }
+
+  LogRecordHeader record = {
+    LOG_RECORD_TRACE,
+    (uint16_t)(sizeof(TraceDumpRecord) + header.count * sizeof(TraceEntry))
+  };
+  TraceFile.write((const uint8_t *)&record, sizeof(LogRecordHeader));
+  TraceFile.write((const uint8_t *)&header, sizeof(TraceDumpRecord));
+
+  // Oldest Entry First
+  for (uint32_t entry = recorded - header.count; entry != recorded; entry++)
+  {
+    TraceFile.write(
+      (const uint8_t *)&TraceRing[entry % TRACE_RING_LEN],
+      sizeof(TraceEntry)
+    );
+  }
+
+  TraceFile.close();
+}
@@ -0,0 +1,57 @@
+#ifndef _TRACE_H_
+#define _TRACE_H_
+// #### Library Headers
+// Fixed Width Integer Types
+#include <stdint.h>
+
+// STM32 L4 Board HAL Status Codes
+#include <stm32l4xx_hal.h>
+
+
+// #### Internal Headers
+// Binary Logfile Record Definitions
+#include "LogFormat.hpp"
+
+
+// #### Trace Definitions
+// FSM Entered a New State, Code = State ID
+#define TRACE_STATE 1
+// HAL Call Returned, Code = HAL Status, Arg = Source Line in DMADAQ.cpp
+#define TRACE_HAL 2
+// ADC or DMA Fault Callback, Arg = Block Flags, Value = HAL ADC Error Code
+#define TRACE_ADC_ERROR 3
+// Regular Block Written, Arg = Samples Filled in DMA Buffer, Value = Write Time (us)
+#define TRACE_BLOCK_WRITE 4
+// ErrorBlink Called, Code = Error Code
+#define TRACE_ERROR 5
+
+// Block Flags in Arg of TRACE_ADC_ERROR
+#define TRACE_FLAG_WRITING 0X01U
+#define TRACE_FLAG_READY 0X02U
+
+// Number of Most Recent Entries Kept, 12 Bytes Each
+#define TRACE_RING_LEN 128
+
+// Dedicated Trace File on SD Card, Dumps are Appended
+#define TRACE_FILE "Trace.trc"
+
+// Current Trace Dump Layout Version
+#define TRACE_FORMAT_VERSION 1
+
+
+// #### Trace Ring Functions
+// Record Entry with Cycle Accurate Timestamp
+// Safe to Call from Interrupts, Overwrites the Oldest Entry When Full
+void Trace(uint8_t Kind, uint8_t Code, uint16_t Arg = 0, uint32_t Value = 0);
+
+// Record FSM State Only When it Changes
+void TraceState(uint8_t State);
+
+// Record HAL Call Result and Pass it Through
+HAL_StatusTypeDef TraceHAL(uint16_t Line, HAL_StatusTypeDef Status);
+
+// Append Trace Ring to the Trace File Before Halting
+// Called by ErrorBlink, Skipped if the SD Card is Unavailable
+void DumpTrace(uint8_t Error);
+
+#endif
@@ -13,6 +13,15 @@
 // State Predicate and Process Definitions
 #include "States.hpp"
 
+// Event Marker Queue
+#include "Events.hpp"
+
+// Bulk Log Download over Serial
+#include "Download.hpp"
+
+// Sync Pulse Edge Capture
+#include "Sync.hpp"
+
 
 // #### Internal Definitions
 // Define State Transitions and Corresponding Relationships
@@ -37,6 +46,9 @@ FiniteState FSM(StateTransitions, TotalTransitions);
 // #### STM32 Nucleo L412KB Hardware Setup
 void setup()
 {
+  // Watermark Free Stack for Peak Usage Reports
+  ConfigureMemoryReport();
+
   // Setup Igniters Pins
   pinMode(FIRE_PIN_A, OUTPUT);
   pinMode(FIRE_PIN_B, OUTPUT);
@@ -50,6 +62,17 @@ void setup()
   pinMode(STATUS_PIN, OUTPUT);
   digitalWrite(STATUS_PIN, LOW);
 
+  // Start Cycle Counter for Event Timestamps
+  ConfigureEvents();
+
+  // Start Serial Link for Log Downloads
+  ConfigureDownload();
+
+#ifdef USE_SYNC_INPUT
+  // Start Capturing Sync Pulse Edges
+  ConfigureSync();
+#endif
+
   // Begin Finite State Machine in BOOT State
   FSM.begin(BOOT);
 }
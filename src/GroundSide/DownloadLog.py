@@ -0,0 +1,201 @@
+#### Python Receiver for Bulk FireSide Log Downloads over Serial
+
+
+#### Library Imports
+# Serial Link to FireSide USB and STLink Port
+from serial import Serial, SerialException
+from serial.tools.list_ports import comports
+
+# Frame Decoding and Checksums
+from struct import Struct
+from zlib import crc32
+
+# Transfer Timing and Retry Delays
+from time import monotonic, sleep
+
+# Partial File Handling for Resumed Downloads
+from os import replace
+from os.path import exists, getsize
+
+# Graceful Script Termination
+from sys import exit
+
+
+#### Download Protocol Definitions
+# See Download.hpp and Interfaces.hpp in FireSide
+DOWNLOAD_UART_BAUD = 921600
+DOWNLOAD_FRAME_MAGIC = 0xD5AA
+FRAME_MAGIC_BYTES = DOWNLOAD_FRAME_MAGIC.to_bytes(2, 'little')
+DOWNLOAD_CHUNK_LEN = 512
+
+# Frame Header: uint16 Magic, uint16 Length, uint32 Offset, uint32 CRC
+FRAME_HEADER = Struct('<HHII')
+# Host Reply: char Type, uint32 Offset
+DOWNLOAD_REPLY = Struct('<cI')
+DOWNLOAD_REPLY_ACK = b'A'
+DOWNLOAD_REPLY_NAK = b'N'
+
+# Seconds Without Valid Frames Before the Link is Assumed Lost
+LINK_TIMEOUT = 3.0
+# Seconds to Wait for a Request to be Accepted
+REQUEST_TIMEOUT = 2.0
+# Seconds Between Repeated NAKs for the Same Offset
+NAK_INTERVAL = 0.2
+
+
+#### Download Protocol Functions
+# Request File from Offset and Return its Total Size
+def RequestDownload(Link : Serial, FileName : str, Offset : int) -> int:
+  Link.reset_input_buffer()
+  Link.write(('DOWNLOAD ' + FileName + ' ' + str(Offset) + '\n').encode())
+
+  # Skip Stale Frames and RYLR Output Until the Answer Arrives
+  Start = monotonic()
+  while monotonic() - Start < REQUEST_TIMEOUT:
+    Line = Link.read_until(b'\n')
+
+    if b'OK ' in Line:
+      return int(Line[Line.rfind(b'OK ') + 3:].strip())
+
+    if b'ERR ' in Line:
+      raise ValueError(Line[Line.rfind(b'ERR ') + 4:].decode(errors='ignore').strip())
+
+  raise TimeoutError('No Answer to Download Request')
+
+# Read Next Frame, Returns Offset, Payload and Validity
+# Returns None if No Frame Arrived Before the Serial Timeout
+def ReadFrame(Link : Serial):
+  # Scan for Little Endian Magic Word
+  Previous = b''
+  while True:
+    Byte = Link.read(1)
+    if not Byte:
+      return None
+
+    if Previous + Byte == FRAME_MAGIC_BYTES:
+      break
+    Previous = Byte
+
+  Header = Link.read(FRAME_HEADER.size - 2)
+  if len(Header) < FRAME_HEADER.size - 2:
+    return None
+
+  _, Length, Offset, CRC = FRAME_HEADER.unpack(FRAME_MAGIC_BYTES + Header)
+
+  # Corrupt Length, Resynchronise on Next Magic Word
+  if Length > DOWNLOAD_CHUNK_LEN:
+    return Offset, b'', False
+
+  Payload = Link.read(Length)
+  return Offset, Payload, len(Payload) == Length and crc32(Payload) == CRC
+
+# Receive Frames into Part File Until the Transfer Ends
+# Returns Number of Bytes Received
+def ReceiveFile(Link : Serial, Part, Offset : int, Size : int) -> int:
+  Expected = Offset
+  LastFrame = LastReport = Start = monotonic()
+  NAKOffset, NAKTime = None, 0.0
+
+  while True:
+    Frame = ReadFrame(Link)
+    Now = monotonic()
+
+    if Frame is None:
+      if Now - LastFrame > LINK_TIMEOUT:
+        raise TimeoutError('FireSide Stopped Sending')
+      continue
+
+    FrameOffset, Payload, Valid = Frame
+
+    if Valid and FrameOffset == Expected:
+      LastFrame = Now
+
+      # Empty Frame at File End Completes the Transfer
+      if not Payload:
+        if Expected == Size:
+          return Expected - Offset
+        continue
+
+      Part.write(Payload)
+      Expected += len(Payload)
+      Link.write(DOWNLOAD_REPLY.pack(DOWNLOAD_REPLY_ACK, Expected))
+    elif Valid and FrameOffset < Expected:
+      # Duplicate After a Lost ACK, Confirm Progress Again
+      Link.write(DOWNLOAD_REPLY.pack(DOWNLOAD_REPLY_ACK, Expected))
+    elif NAKOffset != Expected or Now - NAKTime > NAK_INTERVAL:
+      # Corrupt or Out of Order Frame, Resend from First Missing Byte
+      Link.write(DOWNLOAD_REPLY.pack(DOWNLOAD_REPLY_NAK, Expected))
+      NAKOffset, NAKTime = Expected, Now
+
+    # Report Progress Every Second
+    if Now - LastReport > 1.0:
+      LastReport = Now
+      print(
+        '{:6.1f}% {:9.1f} KB/s'.format(
+          100.0 * Expected / max(Size, 1),
+          (Expected - Offset) / 1024.0 / max(Now - Start, 1e-6)
+        )
+      )
+
+# Download File to Output Path, Resuming After Disconnects
+def DownloadLog(PortName : str, FileName : str, OutputPath : str, Baud : int = DOWNLOAD_UART_BAUD):
+  PartPath = OutputPath + '.part'
+
+  while True:
+    # Resume from Bytes Already Received
+    Offset = getsize(PartPath) if exists(PartPath) else 0
+
+    try:
+      with Serial(port=PortName, baudrate=Baud, timeout=0.1) as Link:
+        Size = RequestDownload(Link, FileName, Offset)
+        print('\nReceiving ' + FileName + ': ' + str(Size) + ' Bytes from Offset ' + str(Offset))
+
+        Start = monotonic()
+        with open(PartPath, 'ab') as Part:
+          Received = ReceiveFile(Link, Part, Offset, Size)
+        Elapsed = max(monotonic() - Start, 1e-6)
+
+      # Transfer Complete, Publish File
+      replace(PartPath, OutputPath)
+      print(
+        '\nDownload Complete: {} Bytes in {:.1f} s, {:.1f} KB/s'.format(
+          Received, Elapsed, Received / 1024.0 / Elapsed
+        )
+      )
+      return
+
+    except (SerialException, TimeoutError) as Error:
+      # Keep Part File and Retry Once the Link Returns
+      print('\n!!!! Link Lost: ' + str(Error))
+      print('!!!! Resuming Download')
+      sleep(1.0)
+
+
+#### Start Download on User Request
+if __name__ == '__main__':
+  print('\n---')
+  print(' DownloadLog: Bulk Log Download from the FireSide PCB')
+  print('---')
+
+  # Ask User to Select COM Port
+  print('\nLoaded COM Ports:')
+  for port in comports():
+    print(port)
+
+  PortID = input('\nEnter COM Port Number:')
+
+  # Verify the Selected Port Exists
+  if not (('COM' + PortID) in [port.name for port in comports()]):
+    print('\n!!!! Invalid COM Port ID Entered: ' + PortID)
+    input('!!!! Press Any Key to Exit')
+    exit()
+
+  # Select Binary Log on FireSide SD Card
+  FileName = input('Enter Log File Name (e.g. 0.dat):').strip()
+
+  try:
+    DownloadLog('COM' + PortID, FileName, FileName)
+  except ValueError as Error:
+    print('\n!!!! FireSide Refused Download: ' + str(Error))
+
+  input('\nPress Any Key to Exit')
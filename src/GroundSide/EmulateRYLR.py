@@ -0,0 +1,331 @@
+#### Emulated RYLR998 Link to a Stand of FireSide Boards
+# Stands in for GroundSide's Serial RYLR Module when No Hardware is Attached
+# Each Board Follows the Radio Protocol and State Sequence of FireSide,
+# Including Addressing, Reply Slots and Collisions Between Boards
+
+
+#### Library Imports
+# Timed Radio Deliveries
+from heapq import heappush, heappop
+from threading import Thread, Condition
+from queue import Queue, Empty
+from time import monotonic
+
+# Packet Loss and Trigger Delay Models
+from random import Random
+
+# FireSide Binary Radio Protocol Codec
+from RadioProtocol import (
+  DecodeText, EncodeText, Airtime, COMMAND_TABLE, STATUS_CODES, RADIO_SETTINGS
+)
+
+
+#### Emulation Settings
+# Address of the 1st Emulated Board, Later Boards Follow On
+FIRST_BOARD_ADDRESS = 2
+
+# Seconds on Air of the Longest Packet, Bounds Overlap Checks Between Transmissions
+MAX_AIRTIME = Airtime(((RADIO_SETTINGS['PACKET_LEN'] + 2) // 3) * 4)
+
+# Seconds Between Openings of a Board's Reply Slot
+REPLY_ROUND = RADIO_SETTINGS['REPLY_SLOTS'] * RADIO_SETTINGS['REPLY_SLOT_MS'] / 1000
+
+# Trigger Delay from LAUNCH Reception to Ignition and its Spread in Microseconds
+# Covers Logging Trigger and Igniter Writes in LaunchCheck
+TRIGGER_US = 400
+TRIGGER_JITTER_US = 40
+
+# Logged Channels Reported by Each Board
+BOARD_CHANNELS = 6
+
+# Quick-Look Summary of an Emulated Burn per Channel
+# Baseline, Peak and Impulse in Counts, Peak Time and Time Above Threshold in Milliseconds
+BLOCK_PERIOD_MS = 52
+QUICKLOOK_BASELINE = 620
+QUICKLOOK_PEAK = 3100
+QUICKLOOK_PEAK_MS = 850
+QUICKLOOK_BURN_MS = 2400
+
+# Command Names by Code
+COMMAND_NAMES = {Code: Name for Name, Code in COMMAND_TABLE.items()}
+
+
+#### Packet Encoding
+# Encodes Value as a Little Endian Base 128 Varint
+def EncodeVarint(Value : int) -> bytes:
+  Bytes = bytearray()
+  while True:
+    Byte = Value & 0x7F
+    Value >>= 7
+    Bytes.append(Byte | 0x80 if Value else Byte)
+    if not Value:
+      return bytes(Bytes)
+
+# Encodes a Status Packet of (Name, Values) Messages, as PostStatus does
+def EncodeStatus(Sequence : int, Messages) -> str:
+  Packet = bytearray([Sequence & 0xFF])
+  for Name, Values in Messages:
+    Payload = b''.join(EncodeVarint(Value) for Value in Values)
+    Packet += bytes([STATUS_CODES[Name], len(Payload)]) + Payload
+  return EncodeText(bytes(Packet))
+
+
+#### Emulated FireSide Board
+# Follows DecodeCommand in Radio.cpp and the State Transitions in States.cpp
+class EmulatedBoard:
+  def __init__(self, Link, Address : int, Generator : Random):
+    self.Link = Link
+    self.Address = Address
+    self.Generator = Generator
+    self.State = 'BOOT'
+    self.Sequence = Generator.randrange(256)
+    self.LastCommand = None
+    self.Queued = []
+    self.Sealed = False
+    self.SlotTime = None
+    self.Trigger = None
+    self.Launched = None
+
+    # Time this Board's Module Finishes its Current Transmission
+    self.AirFree = 0.0
+
+  # Queues Status Message in Outgoing Packet
+  # A Queued Group Acknowledgement is Sent Alone First
+  def Post(self, Name : str, *Values):
+    if self.Sealed:
+      self.Flush()
+    self.Queued.append((Name, Values))
+
+  # Sends Queued Messages, Waiting for the Reply Slot After a Group Command
+  # Each Packet of a Group Reply Takes the Slot in the Next Round Until the Queue Empties
+  def Flush(self):
+    if not self.Queued:
+      self.SlotTime = None
+      return
+
+    Delay = 0.0
+    if self.SlotTime is not None:
+      while monotonic() - self.SlotTime > RADIO_SETTINGS['REPLY_GUARD_MS'] / 1000:
+        self.SlotTime += REPLY_ROUND
+      Delay = max(0.0, self.SlotTime - monotonic())
+      self.SlotTime += REPLY_ROUND
+
+    self.Link.Transmit(self, EncodeStatus(self.Sequence, self.Queued), Delay)
+    self.Queued = []
+    self.Sealed = False
+    self.Sequence = (self.Sequence + 1) & 0xFF
+
+  # Handles One Received Packet Text
+  def Receive(self, Sender : int, Text : str):
+    # Packets Not Sent by GroundSide are Skipped, See ParseRYLR
+    if Sender != RADIO_SETTINGS['GROUNDSIDE_ADDRESS']:
+      return
+
+    try:
+      Packet = DecodeText(Text)
+    except ValueError:
+      return
+    if len(Packet) < 3 or Packet[2] != 0:
+      return
+
+    Sequence = Packet[0]
+    Group = bool(Packet[1] & RADIO_SETTINGS['GROUP_COMMAND'])
+    Command = COMMAND_NAMES.get(Packet[1] & ~RADIO_SETTINGS['GROUP_COMMAND'])
+    if Command is None:
+      return
+
+    self.SlotTime = None
+    if Group:
+      self.SlotTime = monotonic() + (
+        self.Address % RADIO_SETTINGS['REPLY_SLOTS']
+      ) * RADIO_SETTINGS['REPLY_SLOT_MS'] / 1000
+
+    if Command == 'PING':
+      self.Post('BOARD', self.Address, BOARD_CHANNELS)
+    elif not (Group and Command == 'LAUNCH'):
+      self.Post('ACK', Sequence)
+
+    if not Group:
+      self.Flush()
+    else:
+      self.Sealed = bool(self.Queued)
+
+    if Command == 'PING':
+      # Logging Boards Only Answer Once Logging Stops
+      if self.State != 'LOGGING':
+        self.Flush()
+      return
+
+    # Retries of an Accepted Command are Acknowledged and Ignored
+    if Sequence == self.LastCommand:
+      if self.State != 'LOGGING':
+        self.Flush()
+      return
+    self.LastCommand = Sequence
+
+    self.Step(Command, Group)
+
+  # Advances the State Machine on a New Command
+  def Step(self, Command : str, Group : bool):
+    if self.State == 'BOOT':
+      if Command == 'SAFE':
+        self.Post('BOOTING')
+        self.Post('BOOT_COMPLETE')
+        self.Post('FIRESIDE_SAFE')
+      else:
+        self.Post('BOOT_OVERRIDE')
+        self.Post('OVERRIDE_SUCCESSFUL')
+        self.Post('CONVERSION_COMPLETE')
+        self.Post('SAFING')
+      self.State = 'SAFE'
+
+    elif self.State == 'SAFE':
+      if Command == 'ARM':
+        self.Post('ARMING')
+        self.Post('ARMED')
+        self.State = 'ARM'
+
+    elif self.State == 'ARM':
+      if Command == 'LAUNCH':
+        self.Post('LAUNCH_COMMAND')
+        self.Trigger = max(0, round(self.Generator.gauss(TRIGGER_US, TRIGGER_JITTER_US)))
+        self.Launched = monotonic()
+        self.State = 'LOGGING'
+
+        # Group LAUNCH Leaves Notices Queued Until Logging Stops
+        if not Group:
+          self.Post('RADIO_SILENCE')
+          self.Post('STOP_HINT')
+          self.Post('FIRING')
+          self.Flush()
+        return
+      self.Post('ARMING_FAILURE')
+      self.Post('SAFING_IGNITERS')
+      self.State = 'SAFE'
+
+    # Any New Command Stops Logging
+    elif self.State == 'LOGGING':
+      self.Post('LOGGING_STOPPED')
+      self.QuickLook()
+      self.Post('LAUNCH_TRIGGER', self.Trigger)
+      self.Post('CONVERTING')
+      self.Post('CONVERSION_COMPLETE')
+      self.Post('SAFING')
+      self.State = 'SAFE'
+
+    self.Flush()
+
+    # Reply is Complete, the Next PollCommand Finds the Queue Empty
+    self.Flush()
+
+  # Posts Quick-Look Summary of the Emulated Burn, as ReportQuickLook does
+  # Channels Share One Burn Profile with Some Spread Between Them
+  def QuickLook(self):
+    Blocks = round((monotonic() - self.Launched) * 1000) // BLOCK_PERIOD_MS
+    Span = Blocks * BLOCK_PERIOD_MS
+    self.Post('QUICKLOOK_BLOCKS', Blocks, Span)
+
+    Burn = min(Span, QUICKLOOK_BURN_MS)
+    for Input in range(1, BOARD_CHANNELS + 1):
+      Peak = round(self.Generator.gauss(QUICKLOOK_PEAK, 50))
+      Time = min(Span, round(self.Generator.gauss(QUICKLOOK_PEAK_MS, 20)))
+      Impulse = (Peak - QUICKLOOK_BASELINE) * Burn * 2 // 3
+      Value = Time * 2 if Time >= 0 else -Time * 2 - 1
+      self.Post('QUICKLOOK', Input, QUICKLOOK_BASELINE, Peak, Value, Impulse, Burn)
+
+
+#### Emulated RYLR998 Module
+# Serial Object Replacement, Answers AT Commands and Carries Packets
+# To and From Every Emulated Board
+class EmulatedRYLR:
+  def __init__(self, Boards : int, Seed = None, Loss : float = 0.0):
+    self.Generator = Random(Seed)
+    self.Loss = Loss
+    self.Address = 0
+    self.Lines = Queue()
+
+    # Pending Deliveries as (Time, Order, Action)
+    self.Pending = []
+    self.Order = 0
+    self.Wake = Condition()
+
+    # Board Transmissions on Air as (Start, End, Board)
+    self.OnAir = []
+
+    self.Boards = [
+      EmulatedBoard(self, FIRST_BOARD_ADDRESS + Board, Random(self.Generator.random()))
+      for Board in range(Boards)
+    ]
+
+    Thread(target=self.Run, daemon=True).start()
+
+  # Runs Deliveries when Due
+  def Run(self):
+    while True:
+      with self.Wake:
+        while not self.Pending or self.Pending[0][0] > monotonic():
+          self.Wake.wait(self.Pending[0][0] - monotonic() if self.Pending else None)
+        _, _, Action = heappop(self.Pending)
+      Action()
+
+  # Schedules Action after Delay Seconds
+  def Schedule(self, Delay : float, Action):
+    with self.Wake:
+      heappush(self.Pending, (monotonic() + Delay, self.Order, Action))
+      self.Order += 1
+      self.Wake.notify()
+
+  # Sends Board Packet Text to GroundSide's Address after Delay Seconds
+  # Each Module Sends its Packets in Turn, Overlapping Transmissions
+  # from Different Boards Collide and are Lost
+  def Transmit(self, Board : EmulatedBoard, Text : str, Delay : float):
+    Start = max(monotonic() + Delay, Board.AirFree)
+    Board.AirFree = Start + Airtime(len(Text))
+    Delay = Start - monotonic()
+    Slot = (Start, Board.AirFree, Board)
+    with self.Wake:
+      self.OnAir.append(Slot)
+
+    def Deliver():
+      with self.Wake:
+        self.OnAir = [Other for Other in self.OnAir if Other[1] > monotonic() - MAX_AIRTIME]
+        Collided = any(
+          Other[2] is not Board and Other[0] < Slot[1] and Slot[0] < Other[1]
+          for Other in self.OnAir
+        )
+      if Collided or self.Generator.random() < self.Loss:
+        return
+      if self.Address != RADIO_SETTINGS['GROUNDSIDE_ADDRESS']:
+        return
+      self.Lines.put('+RCV={},{},{},-40,11\r\n'.format(Board.Address, len(Text), Text).encode())
+
+    self.Schedule(Slot[1] - monotonic(), Deliver)
+
+  # Accepts AT Commands from GroundSide
+  def write(self, Data : bytes):
+    Line = Data.decode().strip()
+
+    # See +ADDRESS and +SEND in REYAX AT RYLRX98 Commanding Datasheet
+    if Line.startswith('AT+ADDRESS='):
+      self.Address = int(Line[11:])
+    elif Line.startswith('AT+SEND='):
+      Address, _, Text = Line[8:].split(',', maxsplit=2)
+      for Board in self.Boards:
+        if int(Address) in (0, Board.Address) and self.Generator.random() >= self.Loss:
+          self.Schedule(Airtime(len(Text)), lambda Board=Board: Board.Receive(self.Address, Text))
+    else:
+      self.Lines.put(b'+ERR=4\r\n')
+      return len(Data)
+
+    self.Lines.put(b'+OK\r\n')
+    return len(Data)
+
+  # Returns Next Line from the Module, or Nothing after the Read Timeout
+  def read_until(self, Terminator = b'\n'):
+    try:
+      return self.Lines.get(timeout=0.1)
+    except Empty:
+      return b''
+
+  def close(self):
+    pass
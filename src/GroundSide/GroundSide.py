@@ -2,20 +2,42 @@
 
 
 #### Library Imports
-# Serial and Delays for RYLR Communication
+# Serial and Timing for RYLR Communication
 from serial import Serial
-from time import sleep
+from time import monotonic, sleep
+
+# Command Line Options
+from argparse import ArgumentParser
+
+# Concurrent Receive Path and Session Transcript
+from threading import Thread, Lock, Condition
+from datetime import datetime
 
 # Serial COM Port Selection
 from serial.tools.list_ports import comports
 
 # Launch Confirmation Sequence Generation
-from secrets import choice
+from secrets import choice, randbelow
 from string import ascii_letters, digits, punctuation
 
 # Graceful Script Termination
 from sys import exit
 
+# FireSide Binary Radio Protocol Codec
+from RadioProtocol import DecodePacket, EncodeCommand, FormatMessage, STATUS_CODES, RADIO_SETTINGS
+
+
+#### Command Line Options
+# Emulated Boards Replace the RYLR Module for Testing Without Hardware
+Parser = ArgumentParser(description='GroundSide: An Interface to the FireSide PCB')
+Parser.add_argument(
+  '--emulate', type=int, default=0, metavar='BOARDS',
+  help='Run Against Emulated FireSide Boards, See EmulateRYLR.py'
+)
+Parser.add_argument('--loss', type=float, default=0.0, help='Emulated Packet Loss Fraction')
+Parser.add_argument('--seed', type=int, default=None, help='Emulation Random Seed')
+Options = Parser.parse_args()
+
 
 #### Display Startup to User
 print('\n---')
@@ -24,57 +46,187 @@ print('---')
 
 
 #### Setup COM Port
-# Ask User to Select COM Port
-print('\nLoaded COM Ports:')
-for port in comports():
-  print(port)
-
-PortID = input('\nEnter COM Port Number:')
-
-# Check User Input String
-try:
-  # Verify the Selected Port Exists
-  if not (('COM' + PortID) in [port.name for port in comports()]):
-    raise IndexError
-
-except IndexError:
-  # Notify User of Invalid Input
-  print('\n!!!! Invalid COM Port ID Entered: ' + PortID)
-  input('!!!! Press Any Key to Exit')
-  exit()
-
-# Notify User of Serial Startup
-print('\nStarting Serial on COM' + PortID)
-
-# Create and Configure Serial Object for RYLR998
 # See REYAX RYLR998 Datasheet for UART Configuration Defaults
 RYLR_UART_BAUD = 115200
-RYLR = Serial(
-  port='COM' + PortID,
-  baudrate=RYLR_UART_BAUD,
-  timeout=0.1
-)
-
 
-#### Define Interface Layer Functions to RYLR998 Module
-# Parses Incoming Data from FireSide PCB via RYLR module
-def ParseRYLR() -> str:
-  if not RYLR.in_waiting:
-    # Return Blank Buffer
-    return str('\n')
+if Options.emulate:
+  from EmulateRYLR import EmulatedRYLR
+  print('\nEmulating ' + str(Options.emulate) + ' FireSide Boards')
+  RYLR = EmulatedRYLR(Options.emulate, Options.seed, Options.loss)
 
-  # Load Incoming Binary Data
-  parsed = RYLR.read_until(b'\n').decode()
+# Ask User to Select COM Port
+else:
+  print('\nLoaded COM Ports:')
+  for port in comports():
+    print(port)
+
+  PortID = input('\nEnter COM Port Number:')
+
+  # Check User Input String
+  try:
+    # Verify the Selected Port Exists
+    if not (('COM' + PortID) in [port.name for port in comports()]):
+      raise IndexError
+
+  except IndexError:
+    # Notify User of Invalid Input
+    print('\n!!!! Invalid COM Port ID Entered: ' + PortID)
+    input('!!!! Press Any Key to Exit')
+    exit()
+
+  # Notify User of Serial Startup
+  print('\nStarting Serial on COM' + PortID)
+
+  # Create and Configure Serial Object for RYLR998
+  RYLR = Serial(
+    port='COM' + PortID,
+    baudrate=RYLR_UART_BAUD,
+    timeout=0.1
+  )
+
+
+#### Session Transcript
+# Every Received Line, Sent Command and Round Trip is Kept with its Time
+TRANSCRIPT_PATH = 'GroundSide_' + datetime.now().strftime('%Y%m%d_%H%M%S') + '.txt'
+Transcript = open(TRANSCRIPT_PATH, 'w', buffering=1)
+print('Session Transcript: ' + TRANSCRIPT_PATH)
+
+# Serialises Terminal and Transcript Output from Both Threads
+ReportLock = Lock()
+
+# Prints a Timestamped Line and Adds it to the Transcript
+# Direction Marks Received (RX) and Sent (TX) Lines
+def Report(Line : str, Direction : str = '--'):
+  Stamp = datetime.now().strftime('%H:%M:%S.%f')[:-3]
+  with ReportLock:
+    print(Stamp + ' ' + Line)
+    Transcript.write(Stamp + ' ' + Direction + ' ' + Line + '\n')
 
-  # See +RCV in REYAX AT RYLRX98 Commanding Datasheet
-  # Extract Data in 3rd Comma Separated Field
-  parsed = parsed.split(',', maxsplit=4)[2]
 
-  # Strip and Return Parsed Data
-  return parsed.strip()
+#### Define Interface Layer Functions to RYLR998 Module
+# Command Acknowledgement Timeout in Seconds and Send Attempts
+# Covers Both LoRa Transmissions at RYLR998 Default Air Rate
+ACK_TIMEOUT = 3.0
+COMMAND_RETRIES = 3
+
+# RYLR998 Network Addresses, See Radio.hpp in FireSide
+# Boards Send Only to GroundSide, Address 0 Broadcasts Group Commands to Every Board
+GROUNDSIDE_ADDRESS = RADIO_SETTINGS['GROUNDSIDE_ADDRESS']
+BROADCAST_ADDRESS = 0
+
+# Seconds Until Every Board's Reply Slot has Passed After a Group Command
+REPLY_WINDOW = RADIO_SETTINGS['REPLY_SLOTS'] * RADIO_SETTINGS['REPLY_SLOT_MS'] / 1000 + ACK_TIMEOUT
+
+# Sequence Number of Last Sent Command
+# Starts at Random so a Restarted GroundSide is not Taken for a Retry
+CommandSequence = randbelow(256)
+
+# FireSide Boards Heard, by RYLR Address
+# Each Holds its Last Packet Sequence, Last Acknowledged Command,
+# Channel Count from Discovery and Trigger Delay from the Last LAUNCH
+# Updated by the Receive Thread and Signalled Through BoardsChanged
+Boards = {}
+BoardsChanged = Condition()
+
+# Addresses of Boards Found by the Last Discovery, Commands Go to All of Them
+Stand = []
+
+# Boards Launched by the Last Group LAUNCH, Cleared Once Skew is Reported
+LaunchGroup = []
+
+# Round Trip Times in Seconds per Command, for the Session Summary
+RoundTrips = {}
+
+# Returns a Board's Record, Adding Boards Heard for the First Time
+def FindBoard(Address : int) -> dict:
+  return Boards.setdefault(
+    Address, {'sequence': None, 'acked': None, 'channels': None, 'trigger': None}
+  )
+
+# Trigger Skew of the Last Group LAUNCH, Once Every Launched Board has Reported
+# Every Board Hears the Same Broadcast, so Differences in their Delay from
+# Reception to Ignition are the Skew Between their Triggers
+def TriggerSkew() -> list:
+  Delays = {Address: Boards[Address]['trigger'] for Address in LaunchGroup}
+  if not Delays or None in Delays.values():
+    return []
+  LaunchGroup.clear()
+
+  First = min(Delays.values())
+  return [
+    'TRIGGER SKEW FireSide {}: +{} us'.format(Address, Delay - First)
+    for Address, Delay in sorted(Delays.items())
+  ] + ['TRIGGER SKEW SPREAD: {} us'.format(max(Delays.values()) - First)]
+
+# Parses One Line Received from the RYLR module
+# Returns List of Status Lines for Display
+def ParseRYLR(parsed : str) -> list:
+  # Report Module Errors, Skip Other Responses such as +OK
+  if parsed.startswith('+ERR'):
+    return ['!!!! RYLR Module ' + parsed.strip()]
+  if not parsed.startswith('+RCV='):
+    return []
 
-# Sends State Commands to FireSide PCB via RYLR module
-def SendRYLR(State : str):
+  # See +RCV in REYAX AT RYLRX98 Commanding Datasheet
+  # Sender Address in 1st and Data in 3rd Comma Separated Field
+  Fields = parsed[5:].split(',', maxsplit=4)
+  Address = int(Fields[0])
+  parsed = Fields[2].strip()
+  Prefix = 'FireSide ' + str(Address) + ': '
+
+  # Decode Binary Packet
+  try:
+    Sequence, Messages = DecodePacket(parsed)
+  except ValueError:
+    return ['!!!! Corrupt Packet from FireSide ' + str(Address) + ': ' + parsed]
+
+  Lines = []
+  with BoardsChanged:
+    Board = FindBoard(Address)
+
+    # Warn of Packets Lost in Transit
+    if Board['sequence'] is not None and Sequence != ((Board['sequence'] + 1) & 0XFF):
+      Lines.append('!!!! Missed ' + str((Sequence - Board['sequence'] - 1) & 0XFF) +
+        ' Packets from FireSide ' + str(Address))
+    Board['sequence'] = Sequence
+
+    # Record Acknowledgements, Discovery Replies and Trigger Delays
+    for Code, Values, Text in Messages:
+      if Code == STATUS_CODES['ACK']:
+        Board['acked'] = Values[0]
+        continue
+      if Code == STATUS_CODES['BOARD']:
+        Board['channels'] = Values[1]
+      if Code == STATUS_CODES['LAUNCH_TRIGGER']:
+        Board['trigger'] = Values[0]
+
+      Lines.append(Prefix + FormatMessage(Code, Values, Text))
+
+    Lines += TriggerSkew()
+    BoardsChanged.notify_all()
+
+  return Lines
+
+# Receive Path, Runs in its Own Thread for the Whole Session
+# Every FireSide Message is Shown as Soon as it Arrives
+def ReceiveRYLR():
+  while True:
+    Line = RYLR.read_until(b'\n')
+    if not Line:
+      continue
+
+    for Status in ParseRYLR(Line.decode(errors='ignore')):
+      Report(Status, 'RX')
+
+# Issues Send AT Command for One Packet
+# See +SEND in REYAX AT RYLRX98 Commanding Datasheet
+def SendPacket(Address : int, Packet : str):
+  # Complete Binary Command with Mandatory CRLF Line End
+  RYLR.write(('AT+SEND=' + str(Address) + ',' + str(len(Packet)) + ',' + Packet + '\r\n').encode())
+
+# Checks a State Command and Confirms ARM and LAUNCH with the User
+# Returns the Command to Send, SAFE if Checks Fail
+def ConfirmCommand(State : str) -> str:
   # Check for Invalid Commands or Switches
   OverrideResponse = False
 
@@ -111,54 +263,178 @@ def SendRYLR(State : str):
       print('\n!!!! LAUNCH OTP Invalid. Safing FireSide!')
       OverrideResponse = True
 
-  # Issue Send AT Command
-  # See +SEND in REYAX AT RYLRX98 Commanding Datasheet
-  RYLR.write('AT+SEND=0,'.encode())
-
   # Default to SAFE State if Above Checks Fail
   if OverrideResponse:
     print('\nSending SAFE Command')
-
-    # Issue Payload Length
-    # 4 Characters for SAFE Command
-    # Complete Binary Command with Mandatory CRLF Line End
-    RYLR.write('4,SAFE\r\n'.encode())
-  else:
-    # Issue Payload Length
-    RYLR.write(str(len(State)).encode())
-
-    # Complete Binary Command with Comma and Mandatory CRLF Line End
-    RYLR.write((',' + State + '\r\n').encode())
-
-  return
+    State = 'SAFE'
+
+  return State
+
+# Sends a Command to One Board Until it Acknowledges the Sequence Number
+# Resending a Group Command Reuses its Sequence, so Boards that Already
+# Accepted it Only Acknowledge Again
+def SendCommand(State : str, Address : int, Sequence : int) -> bool:
+  Packet = EncodeCommand(Sequence, State)
+
+  # Status Messages Keep Arriving on the Receive Thread Meanwhile
+  First = monotonic()
+  for Attempt in range(COMMAND_RETRIES):
+    Sent = monotonic()
+    SendPacket(Address, Packet)
+    Report(State + ' #' + str(Sequence) + ' to FireSide ' + str(Address) +
+      ' Attempt ' + str(Attempt + 1), 'TX')
+
+    # Wait for ACK of this Command's Sequence Number
+    with BoardsChanged:
+      Acked = BoardsChanged.wait_for(
+        lambda: FindBoard(Address)['acked'] == Sequence, timeout=ACK_TIMEOUT
+      )
+
+    # Round Trip from this Attempt, and from First Attempt if Resent
+    if Acked:
+      Now = monotonic()
+      RoundTrips.setdefault(State, []).append(Now - Sent)
+      Report('ACK ' + State + ' #' + str(Sequence) + ' FireSide ' + str(Address) +
+        ' ROUND TRIP: {:.0f} ms'.format((Now - Sent) * 1e3) +
+        (' TOTAL: {:.0f} ms'.format((Now - First) * 1e3) if Attempt else ''), 'RX')
+      return True
+
+    Report('!!!! No ACK from FireSide ' + str(Address) + '. Resending ' + State)
+
+  Report('!!!! FireSide ' + str(Address) + ' Did Not Acknowledge ' + State)
+  return False
+
+# Broadcasts a Group Command so Every Board Changes State Together
+# Boards Acknowledge in their Reply Slots, Boards Still Missing are Sent it Directly
+# Group LAUNCH is Sent Once and not Acknowledged, Boards Report their
+# Trigger Delay Once Logging Stops, See TriggerSkew
+def SendGroup(State : str, Addresses : list, Sequence : int) -> bool:
+  Sent = monotonic()
+  SendPacket(BROADCAST_ADDRESS, EncodeCommand(Sequence, State, Group=True))
+  Report(State + ' #' + str(Sequence) + ' to ' + str(len(Addresses)) + ' FireSide Boards', 'TX')
+
+  # Resending LAUNCH Would Stop Logging on Boards that Received it
+  # Boards that Missed it Stay in ARM and Keep Sending Heartbeats
+  if State == 'LAUNCH':
+    with BoardsChanged:
+      for Address in Addresses:
+        Boards[Address]['trigger'] = None
+      LaunchGroup[:] = Addresses
+
+    # Boards Skip these Notices on Group LAUNCH, See LaunchCheck in States.cpp
+    for Notice in ['RADIO_SILENCE', 'STOP_HINT', 'FIRING']:
+      Report(FormatMessage(STATUS_CODES[Notice], [], ''))
+    return True
+
+  # Wait Until Every Reply Slot has Passed
+  with BoardsChanged:
+    BoardsChanged.wait_for(
+      lambda: all(Boards[Address]['acked'] == Sequence for Address in Addresses),
+      timeout=REPLY_WINDOW
+    )
+    Missing = [Address for Address in Addresses if Boards[Address]['acked'] != Sequence]
+
+  Now = monotonic()
+  RoundTrips.setdefault('GROUP ' + State, []).append(Now - Sent)
+  Report('ACK ' + State + ' #' + str(Sequence) + ' FROM {} OF {} BOARDS IN {:.0f} ms'.format(
+    len(Addresses) - len(Missing), len(Addresses), (Now - Sent) * 1e3
+  ), 'RX')
+
+  # Boards whose Command or Reply was Lost
+  return all([SendCommand(State, Address, Sequence) for Address in Missing])
+
+# Broadcasts PING and Collects Replies from Every Reply Slot
+# Boards Answer from BOOT Onwards, and Once Logging Stops
+# Returns Number of Boards Found
+def Discover() -> int:
+  global CommandSequence
+  CommandSequence = (CommandSequence + 1) & 0XFF
+
+  with BoardsChanged:
+    for Board in Boards.values():
+      Board['channels'] = None
+
+  SendPacket(BROADCAST_ADDRESS, EncodeCommand(CommandSequence, 'PING', Group=True))
+  Report('PING #' + str(CommandSequence), 'TX')
+
+  # Short Waits Keep Ctrl+C Responsive
+  Deadline = monotonic() + REPLY_WINDOW
+  while monotonic() < Deadline:
+    sleep(0.1)
+
+  with BoardsChanged:
+    Stand[:] = sorted(
+      Address for Address, Board in Boards.items() if Board['channels'] is not None
+    )
+    Channels = sum(Boards[Address]['channels'] for Address in Stand)
+
+  Report('FOUND {} FIRESIDE BOARDS, {} CHANNELS: {}'.format(
+    len(Stand), Channels, ', '.join(str(Address) for Address in Stand)
+  ))
+  return len(Stand)
+
+# Sends a Command Line from the User
+# 'COMMAND' Goes to Every Discovered Board, 'COMMAND ADDRESS' to One Board
+# 'PING' Repeats Discovery
+def Dispatch(Line : str) -> bool:
+  Words = Line.split()
+  if Words[:1] == ['PING']:
+    return Discover() > 0
+
+  # Pick Target Boards Before Confirming the Command
+  Targets = list(Stand)
+  if len(Words) > 1:
+    if not Words[1].isdigit() or int(Words[1]) not in Stand:
+      print('\n!!!! Unknown FireSide Address: ' + Words[1])
+      return False
+    Targets = [int(Words[1])]
+
+  State = ConfirmCommand(Words[0] if Words else '')
+
+  # Encode Command with Next Sequence Number
+  global CommandSequence
+  CommandSequence = (CommandSequence + 1) & 0XFF
+
+  if len(Targets) == 1:
+    return SendCommand(State, Targets[0], CommandSequence)
+  return SendGroup(State, Targets, CommandSequence)
+
+# Prints Round Trip Statistics per Command for the Session
+def ReportRoundTrips():
+  for State, Times in RoundTrips.items():
+    Report('{} ROUND TRIPS: {} MIN: {:.0f} ms MEAN: {:.0f} ms MAX: {:.0f} ms'.format(
+      State, len(Times), min(Times) * 1e3, sum(Times) / len(Times) * 1e3, max(Times) * 1e3
+    ))
 
 
 #### Establish Communication via RYLR module
-print('\nEstablishing FireSide Link')
-
-# Prompt User for FireSide PCB Initial State
-# Send the Initial State
-SendRYLR(input('Choose Initial State: SAFE || CONVERT'))
-
-# Wait Until FireSide Begins Response to State Command
-while not RYLR.in_waiting:
-  sleep(0.5)
+# Boards Send Only to GroundSide's Address, See +ADDRESS in REYAX AT RYLRX98 Commanding Datasheet
+RYLR.write(('AT+ADDRESS=' + str(GROUNDSIDE_ADDRESS) + '\r\n').encode())
 
-print('\nFireSide Link Acquired')
+# Start Receiving Before the First Command
+Thread(target=ReceiveRYLR, daemon=True).start()
 
+print('\nDiscovering FireSide Boards')
 
-#### Start RYLR Communication Loop
-while True:
-  # Check for Incoming Data from FireSide PCB
-  # Parse and Print Data to the Terminal
-  while RYLR.in_waiting:
-    # Load and Display Line
-    print(ParseRYLR())
-
-  # Check for Incoming Commands from the Terminal
-  # Send Input Command
-  SendRYLR(input())
-
-  # Wait Until FireSide Begins Response to Sent Command
-  while not RYLR.in_waiting:
-    sleep(0.5)
+# End the Session with Ctrl+C or End of Input
+try:
+  # Repeat Until at Least One Board Answers
+  while not Discover():
+    pass
+  Report('FireSide Link Acquired')
+
+  # Prompt User for FireSide PCB Initial State
+  # Send the Initial State
+  Dispatch(input('Choose Initial State: SAFE || CONVERT'))
+
+  #### Start RYLR Communication Loop
+  # Commands are Read Here While the Receive Thread Displays FireSide Messages
+  # Append a Board Address to Command a Single Board
+  while True:
+    Dispatch(input())
+
+except (KeyboardInterrupt, EOFError):
+  Report('Session Ended')
+  ReportRoundTrips()
+  Transcript.close()
+  RYLR.close()
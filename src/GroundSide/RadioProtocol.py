@@ -0,0 +1,158 @@
+#### Python Codec for the FireSide Binary Radio Protocol
+# Status and Command Codes are Read from FireSide's Radio.hpp
+# so Both Ends Always Share One Code Table
+
+
+#### Library Imports
+# Code Table Location and Parsing
+from os.path import dirname, join, realpath
+from re import findall, MULTILINE
+from string import Formatter
+
+# Packet Text Encoding
+from base64 import b64encode, b64decode
+from binascii import Error as EncodingError
+
+
+#### Code Table
+# See Radio.hpp in FireSide
+RADIO_HEADER = join(dirname(realpath(__file__)), '..', 'FireSide', 'Radio.hpp')
+
+# Loads Codes Declared as a Display Format Comment Above a Define
+# Returns Status Table {Code: (Name, Format, Values)} and Command Table {Name: Code}
+def LoadCodeTable(Path = RADIO_HEADER):
+  with open(Path, 'r') as Header:
+    Text = Header.read()
+
+  StatusTable = {}
+  CommandTable = {}
+
+  for Format, Kind, Name, Code in findall(
+    r'^// (.+)\n#define (STATUS|COMMAND)_(\w+) (0X[0-9A-F]+)$', Text, MULTILINE
+  ):
+    if Kind == 'COMMAND':
+      CommandTable[Format.strip()] = int(Code, 16)
+      continue
+
+    # Count Numbered Value Fields in Display Format
+    Values = len({
+      Field for _, Field, _, _ in Formatter().parse(Format)
+      if Field is not None and Field.isdigit()
+    })
+    StatusTable[int(Code, 16)] = (Name, Format.strip(), Values)
+
+  return StatusTable, CommandTable
+
+STATUS_TABLE, COMMAND_TABLE = LoadCodeTable()
+
+# Loads Numeric RADIO_ Settings Shared with FireSide
+# Returns {Name: Value} with the RADIO_ Prefix Removed
+def LoadSettings(Path = RADIO_HEADER):
+  with open(Path, 'r') as Header:
+    Text = Header.read()
+
+  return {
+    Name: int(Value, 0) for Name, Value in
+    findall(r'^#define RADIO_(\w+) (0X[0-9A-F]+|\d+)U?L?$', Text, MULTILINE)
+  }
+
+RADIO_SETTINGS = LoadSettings()
+
+# Status Codes by Name
+STATUS_CODES = {Name: Code for Code, (Name, _, _) in STATUS_TABLE.items()}
+
+# Seconds on Air for a Payload of Length Bytes, as RADIO_AIRTIME_MS in Radio.hpp
+# SX127x Symbol Count with Explicit Header, Payload CRC and Coding Rate 4/5
+def Airtime(Length : int) -> float:
+  Factor = RADIO_SETTINGS['SPREADING_FACTOR']
+  Symbols = RADIO_SETTINGS['PREAMBLE_SYMBOLS'] + 4.25 + 8 + 5 * max(
+    0, -(-(8 * Length - 4 * Factor + 44) // (4 * Factor))
+  )
+  return Symbols * (1 << Factor) / (RADIO_SETTINGS['BANDWIDTH_KHZ'] * 1e3)
+
+
+#### Packet Encoding and Decoding
+# Encodes Unpadded Base64 Text for an RYLR Payload
+def EncodeText(Packet : bytes) -> str:
+  return b64encode(Packet).decode().rstrip('=')
+
+# Decodes Unpadded Base64 Text from an RYLR Payload
+def DecodeText(Text : str) -> bytes:
+  try:
+    return b64decode(Text + '=' * (-len(Text) % 4), validate=True)
+  except EncodingError as Error:
+    raise ValueError('Invalid Packet Text') from Error
+
+# Encodes a Single Command Packet
+# Group Commands are Broadcast to Every Board, See Radio.hpp
+def EncodeCommand(Sequence : int, Command : str, Group : bool = False) -> str:
+  Code = COMMAND_TABLE[Command] | (RADIO_SETTINGS['GROUP_COMMAND'] if Group else 0)
+  return EncodeText(bytes([Sequence & 0xFF, Code, 0]))
+
+# Decodes Little Endian Base 128 Varint at Offset
+# Returns Value and Offset of Next Byte
+def DecodeVarint(Payload : bytes, Offset : int):
+  Value = 0
+  Shift = 0
+  while True:
+    if Offset >= len(Payload):
+      raise ValueError('Truncated Varint')
+    Byte = Payload[Offset]
+    Offset += 1
+    Value |= (Byte & 0x7F) << Shift
+    Shift += 7
+    if not Byte & 0x80:
+      return Value, Offset
+
+# Decodes a Status Packet
+# Returns Sequence Number and List of (Code, Values, Text) Messages
+def DecodePacket(Text : str):
+  Packet = DecodeText(Text)
+  if not Packet:
+    raise ValueError('Empty Packet')
+
+  Messages = []
+  Offset = 1
+  while Offset < len(Packet):
+    if Offset + 2 > len(Packet):
+      raise ValueError('Truncated Message Header')
+
+    Code, Length = Packet[Offset], Packet[Offset + 1]
+    Payload = Packet[Offset + 2:Offset + 2 + Length]
+    if len(Payload) < Length:
+      raise ValueError('Truncated Message')
+    Offset += 2 + Length
+
+    # Leading Varint Values, then Text
+    Count = STATUS_TABLE.get(Code, ('', '', 0))[2]
+    Values = []
+    Position = 0
+    for _ in range(Count):
+      Value, Position = DecodeVarint(Payload, Position)
+      Values.append(Value)
+
+    Messages.append((Code, Values, Payload[Position:].decode(errors='replace')))
+
+  return Packet[0], Messages
+
+# Display Formatter for Status Values
+# !z Decodes ZigZag Signed Values, :c Shows Values in Hundredths
+class StatusFormatter(Formatter):
+  def convert_field(self, Value, Conversion):
+    if Conversion == 'z':
+      return (Value >> 1) ^ -(Value & 1)
+    return super().convert_field(Value, Conversion)
+
+  def format_field(self, Value, Spec):
+    if Spec == 'c':
+      return ('-' if Value < 0 else '') + '{}.{:02d}'.format(*divmod(abs(Value), 100))
+    return super().format_field(Value, Spec)
+
+STATUS_FORMATTER = StatusFormatter()
+
+# Formats a Status Message for Display
+def FormatMessage(Code : int, Values, Text : str) -> str:
+  if Code not in STATUS_TABLE:
+    return 'UNKNOWN STATUS ' + hex(Code) + ' ' + str(Values) + ' ' + Text
+
+  return STATUS_FORMATTER.format(STATUS_TABLE[Code][1], *Values, text=Text)